@@ -0,0 +1,117 @@
+#include "bench.h"
+#include <stdlib.h>
+
+static uint64_t sample_ticks[BENCH_MAX_SAMPLES];
+
+static int compare_ticks(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile over sorted samples
+static uint64_t percentile(const uint64_t *sorted, int count, int pct) {
+    int rank = (pct * count + 99) / 100;
+    if (rank < 1) rank = 1;
+    return sorted[rank - 1];
+}
+
+void bench_run(const bench_kernel_t *kernel, int warmup, int samples, bench_result_t *result) {
+    int calls = kernel->calls > 0 ? kernel->calls : 1;
+    if (samples > BENCH_MAX_SAMPLES) samples = BENCH_MAX_SAMPLES;
+    if (samples < 1) samples = 1;
+    
+    if (kernel->setup) kernel->setup();
+    
+    for (int i = 0; i < warmup; i++) {
+        for (int c = 0; c < calls; c++) kernel->run();
+    }
+    
+    // Batch short kernels so a sample isn't mostly timer overhead
+    uint64_t min_ticks = (uint64_t)TICKS_PER_SECOND * BENCH_MIN_SAMPLE_US / 1000000;
+    while (calls < BENCH_MAX_CALLS) {
+        uint64_t start = platform_ticks();
+        for (int c = 0; c < calls; c++) kernel->run();
+        if (platform_ticks() - start >= min_ticks) break;
+        calls *= 2;
+    }
+    
+    uint64_t total = 0;
+    for (int i = 0; i < samples; i++) {
+        uint64_t start = platform_ticks();
+        for (int c = 0; c < calls; c++) kernel->run();
+        sample_ticks[i] = platform_ticks() - start;
+        total += sample_ticks[i];
+    }
+    
+    qsort(sample_ticks, samples, sizeof(sample_ticks[0]), compare_ticks);
+    
+    result->name = kernel->name;
+    result->samples = samples;
+    result->calls = calls;
+    result->pixels = kernel->pixels;
+    result->min = (double)sample_ticks[0] / calls;
+    result->p50 = (double)percentile(sample_ticks, samples, 50) / calls;
+    result->p90 = (double)percentile(sample_ticks, samples, 90) / calls;
+    result->p99 = (double)percentile(sample_ticks, samples, 99) / calls;
+    result->max = (double)sample_ticks[samples - 1] / calls;
+    result->mean = (double)total / calls / samples;
+}
+
+static double ticks_to_ns(double ticks) {
+    return ticks * 1e9 / (double)TICKS_PER_SECOND;
+}
+
+void bench_print_json(const bench_result_t *results, int count, int warmup, int samples) {
+    bench_printf("{\n");
+    bench_printf("  \"platform\": \"%s\",\n", PLATFORM_NAME);
+    bench_printf("  \"unit\": \"ns/call\",\n");
+    bench_printf("  \"warmup\": %d,\n", warmup);
+    bench_printf("  \"samples\": %d,\n", samples);
+    bench_printf("  \"kernels\": {\n");
+    for (int i = 0; i < count; i++) {
+        const bench_result_t *r = &results[i];
+        bench_printf("    \"%s\": {\"calls\": %d, \"min\": %.1f, \"p50\": %.1f, \"p90\": %.1f, "
+                     "\"p99\": %.1f, \"max\": %.1f, \"mean\": %.1f}%s\n",
+                     r->name, r->calls, ticks_to_ns(r->min), ticks_to_ns(r->p50),
+                     ticks_to_ns(r->p90), ticks_to_ns(r->p99), ticks_to_ns(r->max),
+                     ticks_to_ns(r->mean), i + 1 < count ? "," : "");
+    }
+    bench_printf("  }\n");
+    bench_printf("}\n");
+}
+
+void bench_print_log(const bench_result_t *results, int count, int warmup, int samples) {
+    #if PLATFORM_HOST
+    const char *unit = "ns";
+    #else
+    const char *unit = "cycles";
+    #endif
+    
+    bench_printf("BENCH_BEGIN platform=%s unit=%s warmup=%d samples=%d kernels=%d\n",
+                 PLATFORM_NAME, unit, warmup, samples, count);
+    
+    for (int i = 0; i < count; i++) {
+        const bench_result_t *r = &results[i];
+        #if PLATFORM_HOST
+        double scale = 1e9 / (double)TICKS_PER_SECOND;
+        #else
+        double scale = PLATFORM_CYCLES_PER_TICK;
+        #endif
+        
+        // Integer fields keep the log cheap to format and trivial to parse
+        bench_printf("BENCH name=%s calls=%d pixels=%d min=%lu p50=%lu p90=%lu p99=%lu max=%lu mean=%lu",
+                     r->name, r->calls, r->pixels,
+                     (unsigned long)(r->min * scale), (unsigned long)(r->p50 * scale),
+                     (unsigned long)(r->p90 * scale), (unsigned long)(r->p99 * scale),
+                     (unsigned long)(r->max * scale), (unsigned long)(r->mean * scale));
+        if (r->pixels > 0) {
+            // Per-pixel cost in hundredths, e.g. p50_per_pixel_x100=250 is 2.5/pixel
+            bench_printf(" p50_per_pixel_x100=%lu",
+                         (unsigned long)(r->p50 * scale * 100.0 / r->pixels));
+        }
+        bench_printf("\n");
+    }
+    
+    bench_printf("BENCH_END\n");
+}
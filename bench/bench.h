@@ -0,0 +1,67 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "platform.h"
+
+// =============================================================================
+// Microbenchmark harness
+//
+// Each kernel is warmed up, then timed over a number of samples. A sample
+// times `calls` back-to-back invocations, doubled after warm-up until one
+// sample lasts BENCH_MIN_SAMPLE_US, so sub-microsecond kernels stay well
+// above the timer resolution and overhead. Results are reported per call.
+// =============================================================================
+
+#if PLATFORM_HOST
+#include <stdio.h>
+#define bench_printf            printf
+#else
+#define bench_printf            debugf
+#endif
+
+#define BENCH_MAX_SAMPLES       1024
+#define BENCH_DEFAULT_WARMUP    20
+#define BENCH_DEFAULT_SAMPLES   200
+#define BENCH_MAX_KERNELS       64
+#define BENCH_MIN_SAMPLE_US     20
+#define BENCH_MAX_CALLS         1024
+
+typedef struct {
+    const char *name;
+    void (*setup)(void);        // Optional, runs once before warm-up
+    void (*run)(void);          // One call of the kernel
+    int calls;                  // Minimum calls per timed sample
+    int pixels;                 // Pixels touched per call (0 if not a draw kernel)
+} bench_kernel_t;
+
+typedef struct {
+    const char *name;
+    int samples;
+    int calls;
+    int pixels;
+    // Timer ticks per call
+    double min;
+    double p50;
+    double p90;
+    double p99;
+    double max;
+    double mean;
+} bench_result_t;
+
+// Kernel table (bench_kernels.c)
+extern const bench_kernel_t bench_kernels[];
+extern const int bench_kernel_count;
+
+void bench_kernels_init(surface_t *surface);
+
+// Harness
+void bench_run(const bench_kernel_t *kernel, int warmup, int samples, bench_result_t *result);
+
+// JSON document in ns/call, the format of bench/baselines/*.json
+void bench_print_json(const bench_result_t *results, int count, int warmup, int samples);
+
+// One "BENCH key=value ..." line per kernel in cycles/call on the console
+// (ns/call on the host), for capture over ISViewer/USB log
+void bench_print_log(const bench_result_t *results, int count, int warmup, int samples);
+
+#endif // BENCH_H
@@ -0,0 +1,457 @@
+#include "bench.h"
+#include <math.h>
+#include <string.h>
+#include "config.h"
+#include "audio.h"
+#include "visualizer.h"
+#include "bars.h"
+#include "siggen.h"
+#include "multires.h"
+#include "decimator.h"
+#include "beat.h"
+#include "history.h"
+#include "waterfall.h"
+#include "scope.h"
+#include "peaks.h"
+#include "feedback.h"
+#include "bloom.h"
+#include "lowres.h"
+#include "governor.h"
+#include "hud.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Fixed test signal: a few tones plus LCG noise, identical on every run
+#define BENCH_SIGNAL_LENGTH     16384
+
+static int16_t bench_signal[BENCH_SIGNAL_LENGTH];
+static float fft_output[FFT_SIZE];
+static float multires_output[MULTIRES_OUTPUT_SIZE];
+static int multires_position = 0;
+static float frequency_bins[NUM_FREQUENCY_BINS];
+static audio_track_t bench_track;
+static audio_track_t idle_track;
+static audio_track_t fullrate_track;
+static audio_track_t stereo_track;
+static float fft_output_right[FFT_SIZE];
+static float frequency_bins_right[NUM_FREQUENCY_BINS];
+static decimator_t bench_decimator;
+static beat_tracker_t bench_beat;
+static int beat_frame = 0;
+static band_history_t bench_history;
+static peak_pyramid_t bench_peaks;
+static volatile uint32_t history_checksum;
+static int16_t decimator_output[BUFFER_SIZE];
+static siggen_t bench_siggen;
+static int16_t siggen_output[BUFFER_SIZE];
+static surface_t *bench_surface = NULL;
+static int neon_index = 0;
+
+void bench_kernels_init(surface_t *surface) {
+    static const float tones[4][2] = {
+        {  110.0f, 0.30f },
+        {  440.0f, 0.20f },
+        { 2500.0f, 0.10f },
+        { 7000.0f, 0.05f },
+    };
+    uint32_t seed = 0x12345678;
+    
+    for (int i = 0; i < BENCH_SIGNAL_LENGTH; i++) {
+        float t = (float)i / AUDIO_SAMPLE_RATE;
+        float v = 0.0f;
+        for (int k = 0; k < 4; k++) {
+            v += tones[k][1] * sinf(2.0f * M_PI * tones[k][0] * t);
+        }
+        seed = seed * 1664525u + 1013904223u;
+        v += ((int32_t)(seed >> 16) - 32768) / 32768.0f * 0.05f;
+        bench_signal[i] = (int16_t)(CLAMP(v, -1.0f, 1.0f) * 32767.0f);
+    }
+    
+    bench_track.samples = bench_signal;
+    bench_track.length = BENCH_SIGNAL_LENGTH;
+    bench_track.position = 0;
+    bench_track.playing = 1;
+    
+    // Same samples, tagged as a 2x track so audio_update decimates them
+    fullrate_track = bench_track;
+    fullrate_track.sample_rate = 2 * AUDIO_SAMPLE_RATE;
+    
+    // Same samples read as interleaved L/R frames
+    stereo_track = bench_track;
+    stereo_track.length = BENCH_SIGNAL_LENGTH / 2;
+    stereo_track.channels = 2;
+    
+    memset(&idle_track, 0, sizeof(idle_track));
+    decimator_init(&bench_decimator, 2);
+    beat_init(&bench_beat, (float)AUDIO_SAMPLE_RATE / BUFFER_SIZE);
+    history_init(&bench_history);
+    bench_surface = surface;
+    
+    siggen_demo(&bench_siggen, AUDIO_SAMPLE_RATE);
+    
+    fft_init();
+    fft_compute(bench_signal, fft_output, FFT_SIZE);
+}
+
+// Visualizer kernels share global state: start each from a settled frame
+// The governor stays off so every kernel runs at full quality
+static void setup_visualizer(void) {
+    visualizer_set_mode(VISUALIZER_BARS);
+    init_visualizer();
+    visualizer_set_governor(0);
+    for (int i = 0; i < 30; i++) process_audio();
+}
+
+static void run_fft_compute(void) {
+    fft_compute(bench_signal, fft_output, FFT_SIZE);
+}
+
+// Window straddling the end of the track: the wrap-around path
+static void run_fft_compute_view(void) {
+    sample_view_t view;
+    sample_view_from_track(&view, &bench_track, BENCH_SIGNAL_LENGTH - FFT_SIZE / 2, FFT_SIZE);
+    fft_compute_view(&view, fft_output);
+}
+
+// One frame's Welch batch, as audio_update runs it
+static void run_fft_compute_batch(void) {
+    sample_view_t view;
+    int span = (ANALYSIS_SEGMENTS - 1) * (BUFFER_SIZE / ANALYSIS_SEGMENTS) + FFT_SIZE;
+    sample_view_from_buffer(&view, bench_signal, span);
+    fft_compute_batch(&view, BUFFER_SIZE / ANALYSIS_SEGMENTS, ANALYSIS_SEGMENTS, fft_output);
+}
+
+// One frame of new samples through the octave cascade, as the multires
+// analysis mode runs it
+static void run_multires_compute(void) {
+    sample_view_t view;
+    sample_view_from_track(&view, &bench_track, multires_position, BUFFER_SIZE);
+    multires_compute(&view, multires_output);
+    multires_position = (multires_position + BUFFER_SIZE) % BENCH_SIGNAL_LENGTH;
+}
+
+// The same batch for a left/right pair packed into complex FFTs
+static void run_fft_compute_batch_stereo(void) {
+    sample_view_t left, right;
+    int span = (ANALYSIS_SEGMENTS - 1) * (BUFFER_SIZE / ANALYSIS_SEGMENTS) + FFT_SIZE;
+    sample_view_from_buffer(&left, bench_signal, span);
+    sample_view_from_buffer(&right, bench_signal + span, span);
+    fft_compute_batch_stereo(&left, &right, BUFFER_SIZE / ANALYSIS_SEGMENTS, ANALYSIS_SEGMENTS, fft_output, fft_output_right);
+}
+
+static void run_fft_to_frequency_bins(void) {
+    fft_to_frequency_bins(fft_output, frequency_bins, FFT_SIZE, NUM_FREQUENCY_BINS);
+}
+
+static void run_audio_update(void) {
+    audio_update(&bench_track, frequency_bins);
+}
+
+static void run_audio_update_stereo(void) {
+    audio_update_stereo(&stereo_track, frequency_bins, frequency_bins_right);
+}
+
+static void run_audio_update_decimated(void) {
+    audio_update(&fullrate_track, frequency_bins);
+}
+
+// Jump half the track away: pre-roll through the decimator, no analysis
+static void run_audio_seek_decimated(void) {
+    audio_seek(&fullrate_track, fullrate_track.position + BENCH_SIGNAL_LENGTH / 2);
+}
+
+// One frame of a 2x track down to the analysis rate
+static void run_decimator_2x(void) {
+    decimator_process(&bench_decimator, bench_signal, 2 * BUFFER_SIZE, decimator_output);
+}
+
+static void run_audio_update_demo(void) {
+    audio_update(&idle_track, frequency_bins);
+}
+
+// One band vector into the onset detector and tempo tracker
+static void run_beat_update(void) {
+    frequency_bins[0] = (beat_frame++ & 7) ? 0.0f : 1.0f;     // A kick every 8 frames
+    beat_update(&bench_beat, frequency_bins);
+}
+
+static void run_history_push(void) {
+    history_push(&bench_history, frequency_bins);
+}
+
+// Sequential walk over every stored frame, as a waterfall redraw would do
+static void run_history_scan(void) {
+    uint32_t sum = 0;
+    for (int age = 0; age < HISTORY_FRAMES; age++) {
+        const uint8_t *frame = history_frame(&bench_history, age);
+        for (int b = 0; b < NUM_FREQUENCY_BINS; b++) sum += frame[b];
+    }
+    history_checksum = sum;
+}
+
+static void setup_waterfall(void) {
+    setup_visualizer();
+    visualizer_set_mode(VISUALIZER_WATERFALL);
+}
+
+static void run_waterfall_push(void) {
+    waterfall_push(history_frame(visualizer_history(), 0));
+}
+
+// One frame's trigger search and column reduction, as the scope runs them
+static void run_scope_trigger(void) {
+    sample_view_t view;
+    sample_view_from_buffer(&view, bench_signal, BUFFER_SIZE);
+    history_checksum = (uint32_t)scope_trigger(&view, 1, BUFFER_SIZE - SCOPE_SPAN + 1);
+}
+
+static void run_scope_decimate(void) {
+    sample_view_t view;
+    sample_view_from_buffer(&view, bench_signal, SCOPE_SPAN);
+    scope_decimate(&view, 1, SCOPE_SPAN);
+}
+
+static void run_scope_decimate_stereo(void) {
+    sample_view_t view;
+    sample_view_from_buffer(&view, bench_signal, 2 * SCOPE_SPAN);
+    scope_decimate(&view, 2, SCOPE_SPAN);
+}
+
+static void run_peaks_build(void) {
+    peaks_build(&bench_peaks, &bench_track);
+}
+
+// A full-width overview at a zoom where columns span a few blocks
+static void setup_peaks(void) {
+    peaks_build(&bench_peaks, &bench_track);
+}
+
+static void run_peaks_overview(void) {
+    uint32_t sum = 0;
+    for (int x = 0; x < SCREEN_WIDTH; x++) {
+        int lo, hi;
+        peaks_range(&bench_peaks, x * BENCH_SIGNAL_LENGTH / SCREEN_WIDTH,
+                    (x + 1) * BENCH_SIGNAL_LENGTH / SCREEN_WIDTH, &lo, &hi);
+        sum += (uint32_t)(hi - lo);
+    }
+    history_checksum = sum;
+}
+
+static void setup_scope(void) {
+    setup_visualizer();
+    visualizer_set_mode(VISUALIZER_SCOPE);
+}
+
+static void setup_radial(void) {
+    setup_visualizer();
+    visualizer_set_mode(VISUALIZER_RADIAL);
+}
+
+// One thick rotated bar: two fill-mode triangles
+static void run_rdpq_quad(void) {
+    static const float a[2] = { 160.0f, 120.0f }, b[2] = { 163.0f, 121.0f };
+    static const float c[2] = { 226.0f, 45.0f }, d[2] = { 223.0f, 44.0f };
+    rdpq_attach(bench_surface, NULL);
+    rdpq_set_mode_fill(RGBA32(0xFF, 0x00, 0xFF, 0xFF));
+    rdpq_triangle(&TRIFMT_FILL, a, b, c);
+    rdpq_triangle(&TRIFMT_FILL, a, c, d);
+    rdpq_detach_wait();
+}
+
+static void setup_feedback(void) {
+    setup_visualizer();
+    visualizer_set_feedback(1);
+}
+
+static void run_feedback_fade(void) {
+    feedback_begin();
+}
+
+static void run_feedback_present(void) {
+    feedback_present(bench_surface);
+}
+
+static surface_t bloom_surface;
+
+static void setup_bloom(void) {
+    setup_visualizer();
+    visualizer_set_bloom(1);
+    if (!bloom_surface.buffer) bloom_surface = surface_alloc(FMT_RGBA16, BLOOM_WIDTH, BLOOM_HEIGHT);
+    render_visualizer(bench_surface);
+}
+
+static void run_bloom_blur(void) {
+    bloom_blur(&bloom_surface);
+}
+
+static void run_bloom_apply(void) {
+    bloom_apply(bench_surface);
+}
+
+static void setup_lowres(void) {
+    setup_visualizer();
+    visualizer_set_resolution(RENDER_160x120);
+}
+
+static void run_lowres_present(void) {
+    lowres_present(lowres_target(RENDER_160x120), bench_surface);
+}
+
+static governor_t bench_governor;
+
+static void setup_governor(void) {
+    governor_init(&bench_governor);
+}
+
+// Alternate over and under budget so both branches run
+static void run_governor_update(void) {
+    static uint32_t frame = 0;
+    governor_update(&bench_governor, (frame++ & 1) ? 20000 : 5000);
+}
+
+static void run_hud_draw(void) {
+    hud_draw(bench_surface);
+}
+
+// Values change every call, so both lines are re-rasterized each time
+static void run_hud_set_stats(void) {
+    static uint32_t frame = 0;
+    frame++;
+    hud_set_stats(frame, (int)frame * 1024, 1 << 20, frame * 0.01f, 0.5f, 120.0f + frame);
+}
+
+static void run_scope_draw(void) {
+    scope_draw(bench_surface, COLOR_TEAL);
+}
+
+static void run_waterfall_draw(void) {
+    waterfall_draw(bench_surface, WATERFALL_Y);
+}
+
+static void run_siggen_render(void) {
+    siggen_render(&bench_siggen, siggen_output, BUFFER_SIZE);
+}
+
+static void run_process_audio(void) {
+    process_audio();
+}
+
+static void run_get_neon_color(void) {
+    volatile uint16_t color = get_neon_color(neon_index, (float)neon_index / NUM_BARS);
+    (void)color;
+    neon_index = (neon_index + 1) % NUM_BARS;
+}
+
+static void run_update_bars(void) {
+    update_bars();
+}
+
+static void run_render_visualizer(void) {
+    render_visualizer(bench_surface);
+}
+
+static void run_visualizer_frame(void) {
+    visualizer_frame(bench_surface);
+}
+
+// Draw primitives
+#define BENCH_BAR_LENGTH        MAX_BAR_HEIGHT
+#define BENCH_TEXT              "N64 MUSIC VISUALIZER"
+#define BENCH_TEXT_PIXELS       ((int)(sizeof(BENCH_TEXT) - 1) * 8 * 8)
+
+// draw_neon_line draws onto the surface last bound by render_visualizer
+static void setup_draw(void) {
+    setup_visualizer();
+    render_visualizer(bench_surface);
+}
+
+static void run_fill_screen(void) {
+    graphics_fill_screen(bench_surface, COLOR_BLACK);
+}
+
+static void run_line_vertical(void) {
+    graphics_draw_line(bench_surface, SCREEN_WIDTH / 2, CENTER_Y - BENCH_BAR_LENGTH / 2,
+                       SCREEN_WIDTH / 2, CENTER_Y + BENCH_BAR_LENGTH / 2 - 1, COLOR_PINK);
+}
+
+static void run_line_horizontal(void) {
+    graphics_draw_line(bench_surface, 0, CENTER_Y, SCREEN_WIDTH - 1, CENTER_Y, COLOR_TEAL);
+}
+
+static void run_line_diagonal(void) {
+    graphics_draw_line(bench_surface, 0, 20, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 21, COLOR_PURPLE);
+}
+
+static void run_neon_line(void) {
+    draw_neon_line(SCREEN_WIDTH / 2, CENTER_Y - BENCH_BAR_LENGTH / 2,
+                   SCREEN_WIDTH / 2, CENTER_Y + BENCH_BAR_LENGTH / 2 - 1, COLOR_PINK);
+}
+
+static void run_draw_text(void) {
+    graphics_draw_text(bench_surface, 10, 10, BENCH_TEXT);
+}
+
+#define FRAME_PIXELS            (SCREEN_WIDTH * SCREEN_HEIGHT)
+#define NEON_LINE_PIXELS        (BENCH_BAR_LENGTH * (GLOW_ENABLED ? 5 : 1))
+
+const bench_kernel_t bench_kernels[] = {
+    // Analysis
+    { "fft_compute",            NULL,             run_fft_compute,            1,        0 },
+    { "fft_compute_view",       NULL,             run_fft_compute_view,       1,        0 },
+    { "fft_compute_batch",      NULL,             run_fft_compute_batch,      1,        0 },
+    { "fft_compute_batch_stereo", NULL,           run_fft_compute_batch_stereo, 1,      0 },
+    { "multires_compute",       NULL,             run_multires_compute,       1,        0 },
+    { "fft_to_frequency_bins",  NULL,             run_fft_to_frequency_bins,  1,        0 },
+    { "audio_update",           NULL,             run_audio_update,           1,        0 },
+    { "audio_update_stereo",    NULL,             run_audio_update_stereo,    1,        0 },
+    { "audio_update_decimated", NULL,             run_audio_update_decimated, 1,        0 },
+    { "audio_seek_decimated",   NULL,             run_audio_seek_decimated,   1,        0 },
+    { "decimator_2x",           NULL,             run_decimator_2x,           1,        0 },
+    { "audio_update_demo",      NULL,             run_audio_update_demo,      1,        0 },
+    { "beat_update",            NULL,             run_beat_update,            1,        0 },
+    { "history_push",           NULL,             run_history_push,           1,        0 },
+    { "governor_update",        setup_governor,   run_governor_update,        1,        0 },
+    { "history_scan",           NULL,             run_history_scan,           1,        0 },
+    { "siggen_render",          NULL,             run_siggen_render,          1,        0 },
+    { "process_audio",          setup_visualizer, run_process_audio,          1,        0 },
+    { "update_bars",            setup_visualizer, run_update_bars,            1,        0 },
+    { "get_neon_color",         setup_visualizer, run_get_neon_color,         NUM_BARS, 0 },
+    { "waterfall_push",         setup_waterfall,  run_waterfall_push,         1,        SCREEN_WIDTH },
+    { "scope_trigger",          NULL,             run_scope_trigger,          1,        0 },
+    { "scope_decimate",         NULL,             run_scope_decimate,         1,        0 },
+    { "scope_decimate_stereo",  NULL,             run_scope_decimate_stereo,  1,        0 },
+    { "peaks_build",            NULL,             run_peaks_build,            1,        0 },
+    { "peaks_overview",         setup_peaks,      run_peaks_overview,         1,        0 },
+    
+    // Draw primitives
+    { "fill_screen",            setup_draw,       run_fill_screen,            1,        FRAME_PIXELS },
+    { "line_vertical",          setup_draw,       run_line_vertical,          1,        BENCH_BAR_LENGTH },
+    { "line_horizontal",        setup_draw,       run_line_horizontal,        1,        SCREEN_WIDTH },
+    { "line_diagonal",          setup_draw,       run_line_diagonal,          1,        SCREEN_WIDTH },
+    { "draw_neon_line",         setup_draw,       run_neon_line,              1,        NEON_LINE_PIXELS },
+    { "draw_text",              setup_draw,       run_draw_text,              1,        BENCH_TEXT_PIXELS },
+    { "hud_draw",               setup_visualizer, run_hud_draw,               1,        0 },
+    { "hud_set_stats",          setup_visualizer, run_hud_set_stats,          1,        0 },
+    { "waterfall_draw",         setup_waterfall,  run_waterfall_draw,         1,        SCREEN_WIDTH * WATERFALL_ROWS },
+    { "scope_draw",             setup_scope,      run_scope_draw,             1,        0 },
+    { "rdpq_quad",              setup_draw,       run_rdpq_quad,              1,        0 },
+    { "feedback_fade",          setup_feedback,   run_feedback_fade,          1,        FRAME_PIXELS },
+    { "feedback_present",       setup_feedback,   run_feedback_present,       1,        FRAME_PIXELS },
+    { "bloom_blur",             setup_bloom,      run_bloom_blur,             1,        BLOOM_WIDTH * BLOOM_HEIGHT },
+    { "bloom_apply",            setup_bloom,      run_bloom_apply,            1,        FRAME_PIXELS },
+    { "lowres_present",         setup_lowres,     run_lowres_present,         1,        FRAME_PIXELS },
+    
+    // Full frame
+    { "render_visualizer",      setup_visualizer, run_render_visualizer,      1,        FRAME_PIXELS },
+    { "visualizer_frame",       setup_visualizer, run_visualizer_frame,       1,        FRAME_PIXELS },
+    { "render_waterfall",       setup_waterfall,  run_render_visualizer,      1,        FRAME_PIXELS },
+    { "render_scope",           setup_scope,      run_render_visualizer,      1,        FRAME_PIXELS },
+    { "render_radial",          setup_radial,     run_render_visualizer,      1,        FRAME_PIXELS },
+    { "render_feedback",        setup_feedback,   run_render_visualizer,      1,        FRAME_PIXELS },
+    { "render_bloom",           setup_bloom,      run_render_visualizer,      1,        FRAME_PIXELS },
+    { "render_lowres",          setup_lowres,     run_render_visualizer,      1,        FRAME_PIXELS },
+};
+
+const int bench_kernel_count = sizeof(bench_kernels) / sizeof(bench_kernels[0]);
@@ -0,0 +1,52 @@
+#include "platform.h"
+#include "config.h"
+#include "audio.h"
+#include "bench.h"
+
+// =============================================================================
+// On-console benchmark ROM (make bench)
+//
+// Runs every kernel in bench_kernels[] instead of the visualizer loop and
+// reports cycles/call through debugf (ISViewer / USB log). Capture the log in
+// an emulator or on an ED64 and convert it with tools/bench_log_to_json.py.
+// =============================================================================
+
+#ifndef BENCH_ROM_SAMPLES
+#define BENCH_ROM_SAMPLES       1000
+#endif
+
+#ifndef BENCH_ROM_WARMUP
+#define BENCH_ROM_WARMUP        50
+#endif
+
+static bench_result_t results[BENCH_MAX_KERNELS];
+
+int main(void) {
+    debug_init_isviewer();
+    debug_init_usblog();
+    
+    display_init(RESOLUTION_320x240, DEPTH_16_BPP, 2, GAMMA_NONE, ANTIALIAS_RESAMPLE);
+    graphics_init();
+    rdpq_init();
+    fft_init();
+    
+    surface_t *disp;
+    while (!(disp = display_lock()));
+    
+    bench_kernels_init(disp);
+    
+    int count = 0;
+    for (int i = 0; i < bench_kernel_count && count < BENCH_MAX_KERNELS; i++) {
+        debugf("BENCH_RUN name=%s\n", bench_kernels[i].name);
+        bench_run(&bench_kernels[i], BENCH_ROM_WARMUP, BENCH_ROM_SAMPLES, &results[count++]);
+    }
+    
+    bench_print_log(results, count, BENCH_ROM_WARMUP, BENCH_ROM_SAMPLES);
+    
+    // Leave the last benchmarked frame on screen
+    display_show(disp);
+    
+    while (1);
+    
+    return 0;
+}
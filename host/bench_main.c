@@ -0,0 +1,48 @@
+#include "platform.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+// Host benchmark driver: runs every kernel and prints JSON results, or the
+// same BENCH log lines the console ROM emits with --log.
+//
+// Usage: bench-host [--log] [samples] [warmup] [kernel-name]
+
+int main(int argc, char **argv) {
+    int log_format = 0;
+    if (argc > 1 && strcmp(argv[1], "--log") == 0) {
+        log_format = 1;
+        argc--;
+        argv++;
+    }
+    
+    int samples = argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_SAMPLES;
+    int warmup = argc > 2 ? atoi(argv[2]) : BENCH_DEFAULT_WARMUP;
+    const char *only = argc > 3 ? argv[3] : NULL;
+    
+    if (samples <= 0 || warmup < 0) {
+        fprintf(stderr, "Usage: bench-host [--log] [samples] [warmup] [kernel-name]\n");
+        return 1;
+    }
+    
+    display_init(RESOLUTION_320x240, DEPTH_16_BPP, 2, GAMMA_NONE, ANTIALIAS_RESAMPLE);
+    bench_kernels_init(display_lock());
+    
+    static bench_result_t results[BENCH_MAX_KERNELS];
+    int count = 0;
+    
+    for (int i = 0; i < bench_kernel_count && count < BENCH_MAX_KERNELS; i++) {
+        if (only && strcmp(only, bench_kernels[i].name) != 0) continue;
+        bench_run(&bench_kernels[i], warmup, samples, &results[count++]);
+    }
+    
+    if (log_format) {
+        bench_print_log(results, count, warmup, samples);
+    } else {
+        bench_print_json(results, count, warmup, samples);
+    }
+    
+    display_close();
+    return 0;
+}
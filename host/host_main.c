@@ -0,0 +1,65 @@
+#include "platform.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "config.h"
+#include "audio.h"
+#include "visualizer.h"
+
+// Host-native driver: runs the visualizer headless for a fixed number of
+// frames and reports the average frame time.
+//
+// Usage: visualizer-host [frames] [output.ppm] [mode] [feedback] [bloom] [resolution]
+// mode: 0 = bars, 1 = waterfall, 2 = scope, 3 = radial
+// resolution: 0 = 320x240, 1 = 256x192, 2 = 160x120
+
+int main(int argc, char **argv) {
+    int frames = argc > 1 ? atoi(argv[1]) : 600;
+    const char *ppm_file = argc > 2 ? argv[2] : NULL;
+    int mode = argc > 3 ? atoi(argv[3]) : VISUALIZER_MODE;
+    int feedback = argc > 4 ? atoi(argv[4]) : FEEDBACK_ENABLED;
+    int bloom = argc > 5 ? atoi(argv[5]) : BLOOM_ENABLED;
+    int resolution = argc > 6 ? atoi(argv[6]) : RENDER_RESOLUTION;
+    
+    if (frames <= 0 || mode < 0 || mode >= VISUALIZER_MODE_COUNT || resolution < 0 || resolution >= RENDER_RES_COUNT) {
+        fprintf(stderr, "Usage: %s [frames] [output.ppm] [mode] [feedback] [bloom] [resolution]\n", argv[0]);
+        return 1;
+    }
+    
+    display_init(RESOLUTION_320x240, DEPTH_16_BPP, 2, GAMMA_NONE, ANTIALIAS_RESAMPLE);
+    graphics_init();
+    rdpq_init();
+    visualizer_audio_init();
+    fft_init();
+    visualizer_set_mode((visualizer_mode_t)mode);
+    init_visualizer();
+    visualizer_set_feedback(feedback);
+    visualizer_set_bloom(bloom);
+    visualizer_set_resolution((render_res_t)resolution);
+    
+    surface_t *disp = NULL;
+    uint64_t start = platform_ticks();
+    
+    for (int i = 0; i < frames; i++) {
+        disp = display_lock();
+        visualizer_frame(disp);
+        display_show(disp);
+    }
+    
+    uint64_t elapsed_us = platform_ticks_to_us(platform_ticks() - start);
+    printf("platform: %s\n", PLATFORM_NAME);
+    printf("frames: %d\n", frames);
+    printf("total: %llu us\n", (unsigned long long)elapsed_us);
+    printf("per frame: %.2f us\n", (double)elapsed_us / frames);
+    
+    if (ppm_file && disp) {
+        if (host_surface_write_ppm(disp, ppm_file) != 0) {
+            fprintf(stderr, "Failed to write %s\n", ppm_file);
+            return 1;
+        }
+        printf("last frame: %s\n", ppm_file);
+    }
+    
+    display_close();
+    return 0;
+}
@@ -0,0 +1,204 @@
+#ifndef HOST_LIBDRAGON_H
+#define HOST_LIBDRAGON_H
+
+// =============================================================================
+// Minimal libdragon stub for the host-native build
+//
+// Implements only the subset of the libdragon API the visualizer uses. The
+// display is a set of RAM framebuffers, debugf goes to stderr and audio is a
+// no-op. Drawing routines mirror libdragon's software graphics module so
+// per-pixel cost is comparable.
+// =============================================================================
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Timer
+#define TICKS_PER_SECOND        1000000000ULL
+
+uint64_t get_ticks(void);
+
+// Debug output
+#define debugf(...)             fprintf(stderr, __VA_ARGS__)
+
+void debug_init_isviewer(void);
+void debug_init_usblog(void);
+
+// Surfaces
+typedef struct surface_s {
+    uint16_t flags;
+    uint16_t width;
+    uint16_t height;
+    uint16_t stride;
+    void *buffer;
+} surface_t;
+
+typedef enum {
+    FMT_NONE,
+    FMT_RGBA16,
+    FMT_RGBA32,
+    FMT_I8
+} tex_format_t;
+
+surface_t surface_alloc(tex_format_t format, uint16_t width, uint16_t height);
+void surface_free(surface_t *surface);
+
+// Display
+typedef struct {
+    int32_t width;
+    int32_t height;
+    int interlaced;
+} resolution_t;
+
+typedef enum {
+    DEPTH_16_BPP,
+    DEPTH_32_BPP
+} bitdepth_t;
+
+typedef enum {
+    GAMMA_NONE,
+    GAMMA_CORRECT,
+    GAMMA_CORRECT_DITHER
+} gamma_t;
+
+typedef enum {
+    FILTERS_DISABLED,
+    FILTERS_RESAMPLE,
+    FILTERS_DEDITHER,
+    FILTERS_RESAMPLE_ANTIALIAS,
+    FILTERS_RESAMPLE_ANTIALIAS_DEDITHER
+} filter_options_t;
+
+#define ANTIALIAS_RESAMPLE      FILTERS_RESAMPLE
+
+static const resolution_t RESOLUTION_320x240 = { 320, 240, 0 };
+
+void display_init(resolution_t res, bitdepth_t bit, uint32_t num_buffers,
+                  gamma_t gamma, filter_options_t filters);
+void display_close(void);
+surface_t *display_lock(void);
+void display_show(surface_t *surf);
+
+// Software graphics
+void graphics_init(void);
+void graphics_set_color(uint32_t forecolor, uint32_t backcolor);
+void graphics_fill_screen(surface_t *surf, uint32_t color);
+void graphics_draw_pixel(surface_t *surf, int x, int y, uint32_t color);
+void graphics_draw_line(surface_t *surf, int x0, int y0, int x1, int y1, uint32_t color);
+void graphics_draw_box(surface_t *surf, int x, int y, int width, int height, uint32_t color);
+void graphics_draw_character(surface_t *surf, int x, int y, char c);
+void graphics_draw_text(surface_t *surf, int x, int y, const char * const msg);
+
+// RDP (rasterized on the CPU into the attached surface). Fill mode draws
+// rectangles and triangles; textures are only blitted, in copy mode or in
+// standard mode through one of the predefined combiners below.
+typedef struct {
+    uint8_t r, g, b, a;
+} color_t;
+
+#define RGBA32(rx, gx, bx, ax)  ((color_t){ .r = (rx), .g = (gx), .b = (bx), .a = (ax) })
+
+// 16-bit surfaces are RGBA5551, as on the console: 5 bits per channel and
+// the alpha bit in bit 0
+static inline uint16_t color_to_packed16(color_t c) {
+    return (uint16_t)(((c.r >> 3) << 11) | ((c.g >> 3) << 6) | ((c.b >> 3) << 1) | (c.a >> 7));
+}
+
+static inline color_t color_from_packed16(uint16_t c) {
+    return RGBA32(((c >> 11) & 0x1F) << 3, ((c >> 6) & 0x1F) << 3, ((c >> 1) & 0x1F) << 3, (c & 1) ? 0xFF : 0);
+}
+
+typedef struct {
+    int pos_offset;
+    int shade_offset;
+    int tex_offset;
+    int z_offset;
+} rdpq_trifmt_t;
+
+extern const rdpq_trifmt_t TRIFMT_FILL;
+
+typedef uint64_t rdpq_combiner_t;
+
+#define RDPQ_COMBINER_FLAT      1       // Prim color
+#define RDPQ_COMBINER_TEX       2       // Texture as-is
+#define RDPQ_COMBINER_TEX_FLAT  3       // Texture modulated by the prim color
+
+typedef uint32_t rdpq_blender_t;
+
+#define RDPQ_BLENDER_ADDITIVE   1       // Framebuffer + incoming * its alpha, saturated
+
+typedef enum {
+    FILTER_POINT,
+    FILTER_BILINEAR,
+    FILTER_MEDIAN
+} rdpq_filter_t;
+
+typedef struct {
+    int tile;
+    int s0, t0;
+    int width, height;
+    float scale_x, scale_y;             // 0 = 1.0
+} rdpq_blitparms_t;
+
+void rdpq_init(void);
+void rdpq_close(void);
+void rdpq_attach(const surface_t *surf_color, const surface_t *surf_z);
+void rdpq_attach_clear(const surface_t *surf_color, const surface_t *surf_z);
+void rdpq_detach_wait(void);
+void rdpq_set_mode_fill(color_t color);
+void rdpq_set_fill_color(color_t color);
+void rdpq_set_mode_standard(void);
+void rdpq_set_mode_copy(bool transparency);
+void rdpq_mode_combiner(rdpq_combiner_t comb);
+void rdpq_set_prim_color(color_t color);
+void rdpq_mode_blender(rdpq_blender_t blend);
+void rdpq_mode_filter(rdpq_filter_t filt);
+void rdpq_tex_blit(const surface_t *surf, float x0, float y0, const rdpq_blitparms_t *parms);
+void rdpq_fill_rectangle(float x0, float y0, float x1, float y1);
+void rdpq_triangle(const rdpq_trifmt_t *fmt, const float *v1, const float *v2, const float *v3);
+
+// Joypad (no controller on the host: nothing is ever pressed)
+typedef enum {
+    JOYPAD_PORT_1,
+    JOYPAD_PORT_2,
+    JOYPAD_PORT_3,
+    JOYPAD_PORT_4
+} joypad_port_t;
+
+typedef union {
+    uint32_t raw;
+    struct {
+        unsigned a : 1;
+        unsigned b : 1;
+        unsigned z : 1;
+        unsigned start : 1;
+        unsigned d_up : 1;
+        unsigned d_down : 1;
+        unsigned d_left : 1;
+        unsigned d_right : 1;
+        unsigned y : 1;
+        unsigned x : 1;
+        unsigned l : 1;
+        unsigned r : 1;
+        unsigned c_up : 1;
+        unsigned c_down : 1;
+        unsigned c_left : 1;
+        unsigned c_right : 1;
+        unsigned : 16;
+    };
+} joypad_buttons_t;
+
+void joypad_init(void);
+void joypad_poll(void);
+joypad_buttons_t joypad_get_buttons_pressed(joypad_port_t port);
+joypad_buttons_t joypad_get_buttons_held(joypad_port_t port);
+
+// Audio
+void audio_init(const int frequency, int numbuffers);
+void audio_close(void);
+
+// Host-only helpers (not part of libdragon)
+int host_surface_write_ppm(const surface_t *surf, const char *filename);
+
+#endif // HOST_LIBDRAGON_H
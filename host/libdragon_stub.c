@@ -0,0 +1,426 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include "libdragon.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_DISPLAY_BUFFERS 3
+
+static surface_t display_surfaces[MAX_DISPLAY_BUFFERS];
+static uint32_t display_buffer_count = 0;
+static uint32_t display_next = 0;
+static uint32_t fore_color = 0xFFFF;
+static uint32_t back_color = 0x0000;
+static const surface_t *rdp_target = NULL;
+static uint16_t rdp_fill_color = 0x0000;
+static color_t rdp_prim_color = { 0xFF, 0xFF, 0xFF, 0xFF };
+static rdpq_combiner_t rdp_combiner = RDPQ_COMBINER_TEX;
+static int rdp_copy_mode = 0;
+static int rdp_transparency = 0;
+static rdpq_blender_t rdp_blender = 0;
+static rdpq_filter_t rdp_filter = FILTER_POINT;
+
+const rdpq_trifmt_t TRIFMT_FILL = { 0, -1, -1, -1 };
+
+uint64_t get_ticks(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * TICKS_PER_SECOND + (uint64_t)ts.tv_nsec;
+}
+
+void debug_init_isviewer(void) {}
+void debug_init_usblog(void) {}
+
+surface_t surface_alloc(tex_format_t format, uint16_t width, uint16_t height) {
+    int bpp = format == FMT_RGBA32 ? 4 : (format == FMT_I8 ? 1 : 2);
+    surface_t s;
+
+    s.flags = (uint16_t)format;
+    s.width = width;
+    s.height = height;
+    s.stride = (uint16_t)(width * bpp);
+    s.buffer = calloc(height, s.stride);
+    return s;
+}
+
+void surface_free(surface_t *surface) {
+    free(surface->buffer);
+    surface->buffer = NULL;
+}
+
+void display_init(resolution_t res, bitdepth_t bit, uint32_t num_buffers,
+                  gamma_t gamma, filter_options_t filters) {
+    (void)gamma;
+    (void)filters;
+
+    int bpp = (bit == DEPTH_32_BPP) ? 4 : 2;
+    if (num_buffers > MAX_DISPLAY_BUFFERS) num_buffers = MAX_DISPLAY_BUFFERS;
+
+    display_close();
+    for (uint32_t i = 0; i < num_buffers; i++) {
+        surface_t *s = &display_surfaces[i];
+        s->flags = (uint16_t)bpp;
+        s->width = (uint16_t)res.width;
+        s->height = (uint16_t)res.height;
+        s->stride = (uint16_t)(res.width * bpp);
+        s->buffer = calloc((size_t)res.height, s->stride);
+    }
+    display_buffer_count = num_buffers;
+    display_next = 0;
+}
+
+void display_close(void) {
+    for (uint32_t i = 0; i < display_buffer_count; i++) {
+        free(display_surfaces[i].buffer);
+        display_surfaces[i].buffer = NULL;
+    }
+    display_buffer_count = 0;
+}
+
+surface_t *display_lock(void) {
+    if (display_buffer_count == 0) return NULL;
+
+    surface_t *s = &display_surfaces[display_next];
+    display_next = (display_next + 1) % display_buffer_count;
+    return s;
+}
+
+void display_show(surface_t *surf) {
+    (void)surf;
+}
+
+void graphics_init(void) {}
+
+void graphics_set_color(uint32_t forecolor, uint32_t backcolor) {
+    fore_color = forecolor;
+    back_color = backcolor;
+}
+
+void graphics_fill_screen(surface_t *surf, uint32_t color) {
+    uint16_t *buf = (uint16_t *)surf->buffer;
+    int count = surf->width * surf->height;
+
+    for (int i = 0; i < count; i++) {
+        buf[i] = (uint16_t)color;
+    }
+}
+
+void graphics_draw_pixel(surface_t *surf, int x, int y, uint32_t color) {
+    if (x < 0 || y < 0 || x >= surf->width || y >= surf->height) return;
+
+    uint16_t *row = (uint16_t *)((uint8_t *)surf->buffer + y * surf->stride);
+    row[x] = (uint16_t)color;
+}
+
+void graphics_draw_line(surface_t *surf, int x0, int y0, int x1, int y1, uint32_t color) {
+    // Bresenham, clipped per pixel like libdragon's software renderer
+    int dx = abs(x1 - x0);
+    int dy = -abs(y1 - y0);
+    int sx = x0 < x1 ? 1 : -1;
+    int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+
+    while (1) {
+        graphics_draw_pixel(surf, x0, y0, color);
+        if (x0 == x1 && y0 == y1) break;
+
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+void graphics_draw_box(surface_t *surf, int x, int y, int width, int height, uint32_t color) {
+    for (int j = y; j < y + height; j++) {
+        for (int i = x; i < x + width; i++) {
+            graphics_draw_pixel(surf, i, j, color);
+        }
+    }
+}
+
+void graphics_draw_character(surface_t *surf, int x, int y, char c) {
+    // No font on the host: each glyph is an 8x8 cell with a pattern derived
+    // from the character code, which keeps the per-pixel cost of text honest.
+    for (int row = 0; row < 8; row++) {
+        uint8_t bits = (uint8_t)(((unsigned char)c * 0x9Du) >> (row & 3));
+        for (int col = 0; col < 8; col++) {
+            if (c != ' ' && (bits & (0x80 >> col))) {
+                graphics_draw_pixel(surf, x + col, y + row, fore_color);
+            } else if (back_color & 1) {
+                // Like libdragon, an alpha-0 background leaves pixels alone
+                graphics_draw_pixel(surf, x + col, y + row, back_color);
+            }
+        }
+    }
+}
+
+void graphics_draw_text(surface_t *surf, int x, int y, const char * const msg) {
+    if (!msg) return;
+
+    int tx = x;
+    for (const char *p = msg; *p; p++) {
+        if (*p == '\n') {
+            tx = x;
+            y += 8;
+            continue;
+        }
+        graphics_draw_character(surf, tx, y, *p);
+        tx += 8;
+    }
+}
+
+void rdpq_init(void) {}
+
+void rdpq_close(void) {}
+
+void rdpq_attach(const surface_t *surf_color, const surface_t *surf_z) {
+    (void)surf_z;
+    rdp_target = surf_color;
+}
+
+void rdpq_attach_clear(const surface_t *surf_color, const surface_t *surf_z) {
+    rdpq_attach(surf_color, surf_z);
+    memset(surf_color->buffer, 0, (size_t)surf_color->height * surf_color->stride);
+}
+
+void rdpq_detach_wait(void) {
+    rdp_target = NULL;
+}
+
+void rdpq_set_mode_fill(color_t color) {
+    rdpq_set_fill_color(color);
+}
+
+void rdpq_set_fill_color(color_t color) {
+    rdp_fill_color = color_to_packed16(color);
+}
+
+void rdpq_set_mode_standard(void) {
+    rdp_copy_mode = 0;
+    rdp_combiner = RDPQ_COMBINER_TEX;
+    rdp_blender = 0;
+    rdp_filter = FILTER_POINT;
+}
+
+void rdpq_set_mode_copy(bool transparency) {
+    rdp_copy_mode = 1;
+    rdp_transparency = transparency;
+}
+
+void rdpq_mode_combiner(rdpq_combiner_t comb) {
+    rdp_combiner = comb;
+}
+
+void rdpq_set_prim_color(color_t color) {
+    rdp_prim_color = color;
+}
+
+void rdpq_mode_blender(rdpq_blender_t blend) {
+    rdp_blender = blend;
+}
+
+void rdpq_mode_filter(rdpq_filter_t filt) {
+    rdp_filter = filt;
+}
+
+// Source rectangle of the blit, texels clamp to it
+static int tex_s0, tex_t0, tex_width, tex_height;
+
+// RGBA5551 pixel split into 5/5/5/1 channels
+static void unpack_5551(uint16_t c, int *rgba) {
+    rgba[0] = (c >> 11) & 0x1F;
+    rgba[1] = (c >> 6) & 0x1F;
+    rgba[2] = (c >> 1) & 0x1F;
+    rgba[3] = c & 1;
+}
+
+// RGBA5551 texel with clamped coordinates
+static void fetch_texel(const surface_t *surf, int x, int y, int *rgba) {
+    x = tex_s0 + (x < 0 ? 0 : (x >= tex_width ? tex_width - 1 : x));
+    y = tex_t0 + (y < 0 ? 0 : (y >= tex_height ? tex_height - 1 : y));
+    unpack_5551(((const uint16_t *)((const uint8_t *)surf->buffer + y * surf->stride))[x], rgba);
+}
+
+// RGBA16 texture (or its s0/t0/width/height part) onto the attached surface
+// at (x0, y0), scaled and clipped.
+// Standard mode applies the filter, the TEX_FLAT combiner (alpha too) and
+// the additive blender; copy mode only copies, skipping alpha-0 texels when
+// set up with transparency.
+void rdpq_tex_blit(const surface_t *surf, float x0, float y0, const rdpq_blitparms_t *parms) {
+    if (!rdp_target) return;
+
+    float scale_x = parms && parms->scale_x != 0.0f ? parms->scale_x : 1.0f;
+    float scale_y = parms && parms->scale_y != 0.0f ? parms->scale_y : 1.0f;
+    int bilinear = !rdp_copy_mode && rdp_filter == FILTER_BILINEAR;
+    int modulate = !rdp_copy_mode && rdp_combiner == RDPQ_COMBINER_TEX_FLAT;
+    int additive = !rdp_copy_mode && rdp_blender == RDPQ_BLENDER_ADDITIVE;
+    int scale[3] = { rdp_prim_color.r + 1, rdp_prim_color.g + 1, rdp_prim_color.b + 1 };
+    tex_s0 = parms ? parms->s0 : 0;
+    tex_t0 = parms ? parms->t0 : 0;
+    tex_width = parms && parms->width ? parms->width : surf->width - tex_s0;
+    tex_height = parms && parms->height ? parms->height : surf->height - tex_t0;
+    int width = (int)(tex_width * scale_x);
+    int height = (int)(tex_height * scale_y);
+    int dx = (int)x0;
+    int dy = (int)y0;
+
+    for (int y = 0; y < height; y++) {
+        if (y + dy < 0 || y + dy >= rdp_target->height) continue;
+        uint16_t *dst = (uint16_t *)((uint8_t *)rdp_target->buffer + (y + dy) * rdp_target->stride);
+        float v = (y + 0.5f) / scale_y - 0.5f;
+
+        for (int x = 0; x < width; x++) {
+            if (x + dx < 0 || x + dx >= rdp_target->width) continue;
+            float u = (x + 0.5f) / scale_x - 0.5f;
+            int rgb[4];
+
+            if (bilinear) {
+                int tu = (int)floorf(u);
+                int tv = (int)floorf(v);
+                float fu = u - tu;
+                float fv = v - tv;
+                int t00[4], t10[4], t01[4], t11[4];
+                fetch_texel(surf, tu, tv, t00);
+                fetch_texel(surf, tu + 1, tv, t10);
+                fetch_texel(surf, tu, tv + 1, t01);
+                fetch_texel(surf, tu + 1, tv + 1, t11);
+                for (int k = 0; k < 4; k++) {
+                    float top = t00[k] + (t10[k] - t00[k]) * fu;
+                    float bottom = t01[k] + (t11[k] - t01[k]) * fu;
+                    rgb[k] = (int)(top + (bottom - top) * fv + 0.5f);
+                }
+            } else {
+                fetch_texel(surf, (int)((x + 0.5f) / scale_x), (int)((y + 0.5f) / scale_y), rgb);
+            }
+
+            if (rdp_copy_mode && rdp_transparency && !rgb[3]) continue;
+            if (modulate) {
+                for (int k = 0; k < 3; k++) rgb[k] = (rgb[k] * scale[k]) >> 8;
+                rgb[3] = rgb[3] && rdp_prim_color.a >= 0x80;
+            }
+            if (additive) {
+                // Incoming is weighted by its 1-bit alpha
+                if (!rgb[3]) continue;
+                int mem[4];
+                unpack_5551(dst[x + dx], mem);
+                for (int k = 0; k < 3; k++) {
+                    rgb[k] += mem[k];
+                    if (rgb[k] > 0x1F) rgb[k] = 0x1F;
+                }
+            }
+            dst[x + dx] = (uint16_t)((rgb[0] << 11) | (rgb[1] << 6) | (rgb[2] << 1) | rgb[3]);
+        }
+    }
+}
+
+void rdpq_fill_rectangle(float x0, float y0, float x1, float y1) {
+    if (!rdp_target) return;
+
+    int ix0 = x0 < 0 ? 0 : (int)x0;
+    int iy0 = y0 < 0 ? 0 : (int)y0;
+    int ix1 = x1 > rdp_target->width ? rdp_target->width : (int)x1;
+    int iy1 = y1 > rdp_target->height ? rdp_target->height : (int)y1;
+
+    for (int y = iy0; y < iy1; y++) {
+        uint16_t *row = (uint16_t *)((uint8_t *)rdp_target->buffer + y * rdp_target->stride);
+        for (int x = ix0; x < ix1; x++) {
+            row[x] = rdp_fill_color;
+        }
+    }
+}
+
+// Narrow [lo, hi] on a row at height py to where edge a->b is on the
+// inside (sign) of the triangle; the edge function is linear in x there
+static void clip_edge(const float *a, const float *b, float sign, float py, float *lo, float *hi) {
+    float k = sign * (b[1] - a[1]);
+    float c = sign * ((b[0] - a[0]) * (py - a[1]) + (b[1] - a[1]) * a[0]);
+
+    if (k > 0.0f) {
+        if (c / k < *hi) *hi = c / k;
+    } else if (k < 0.0f) {
+        if (c / k > *lo) *lo = c / k;
+    } else if (c < 0.0f) {
+        *hi = *lo - 1.0f;
+    }
+}
+
+// Pixels whose centers fall inside the triangle, either winding, one span
+// per row like the RDP's edge walker
+void rdpq_triangle(const rdpq_trifmt_t *fmt, const float *v1, const float *v2, const float *v3) {
+    (void)fmt;
+    if (!rdp_target) return;
+
+    float area = (v2[0] - v1[0]) * (v3[1] - v1[1]) - (v2[1] - v1[1]) * (v3[0] - v1[0]);
+    if (area == 0.0f) return;
+    float sign = area > 0.0f ? 1.0f : -1.0f;
+
+    float min_y = v1[1] < v2[1] ? v1[1] : v2[1];
+    float max_y = v1[1] > v2[1] ? v1[1] : v2[1];
+    if (v3[1] < min_y) min_y = v3[1];
+    if (v3[1] > max_y) max_y = v3[1];
+
+    int y0 = min_y < 0 ? 0 : (int)min_y;
+    int y1 = max_y >= rdp_target->height ? rdp_target->height - 1 : (int)max_y;
+
+    for (int y = y0; y <= y1; y++) {
+        float py = y + 0.5f;
+        float lo = 0.0f;
+        float hi = (float)rdp_target->width;
+        clip_edge(v1, v2, sign, py, &lo, &hi);
+        clip_edge(v2, v3, sign, py, &lo, &hi);
+        clip_edge(v3, v1, sign, py, &lo, &hi);
+
+        int x0 = (int)ceilf(lo - 0.5f);
+        int x1 = (int)floorf(hi - 0.5f);
+        if (x1 >= rdp_target->width) x1 = rdp_target->width - 1;
+
+        uint16_t *row = (uint16_t *)((uint8_t *)rdp_target->buffer + y * rdp_target->stride);
+        for (int x = x0 < 0 ? 0 : x0; x <= x1; x++) {
+            row[x] = rdp_fill_color;
+        }
+    }
+}
+
+void joypad_init(void) {}
+
+void joypad_poll(void) {}
+
+joypad_buttons_t joypad_get_buttons_pressed(joypad_port_t port) {
+    joypad_buttons_t none = { 0 };
+    (void)port;
+    return none;
+}
+
+joypad_buttons_t joypad_get_buttons_held(joypad_port_t port) {
+    joypad_buttons_t none = { 0 };
+    (void)port;
+    return none;
+}
+
+void audio_init(const int frequency, int numbuffers) {
+    (void)frequency;
+    (void)numbuffers;
+}
+
+void audio_close(void) {}
+
+int host_surface_write_ppm(const surface_t *surf, const char *filename) {
+    FILE *f = fopen(filename, "wb");
+    if (!f) return -1;
+
+    fprintf(f, "P6\n%d %d\n255\n", surf->width, surf->height);
+    for (int y = 0; y < surf->height; y++) {
+        const uint16_t *row = (const uint16_t *)((const uint8_t *)surf->buffer + y * surf->stride);
+        for (int x = 0; x < surf->width; x++) {
+            // RGBA5551 -> RGB888, alpha dropped like the VI does
+            color_t c = color_from_packed16(row[x]);
+            uint8_t rgb[3] = { c.r, c.g, c.b };
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+
+    fclose(f);
+    return 0;
+}
@@ -1,6 +1,10 @@
 #include "audio.h"
 #include "config.h"
-#include <libdragon.h>
+#include "platform.h"
+#include "siggen.h"
+#include "filterbank.h"
+#include "multires.h"
+#include "decimator.h"
 #include <malloc.h>
 #include <string.h>
 #include <math.h>
@@ -12,7 +16,56 @@
 // Global audio variables
 static float cos_table[FFT_SIZE];
 static float sin_table[FFT_SIZE];
+static uint16_t bitrev_table[FFT_SIZE];
+
+// Active analysis window with the 16-bit normalization folded in
+static float window_table[FFT_SIZE];
+static fft_window_t window_type = FFT_WINDOW;
+
+// FFT scratch, shared by every transform entry point
+static float fft_real[FFT_SIZE];
+static float fft_imag[FFT_SIZE];
+static float fft_power[FFT_SIZE / 2];
+static float fft_power_right[FFT_SIZE / 2];
+
+// Samples covered by one frame's batch of overlapping windows
+#define ANALYSIS_HOP            (BUFFER_SIZE / ANALYSIS_SEGMENTS)
+#define ANALYSIS_SPAN           ((ANALYSIS_SEGMENTS - 1) * ANALYSIS_HOP + FFT_SIZE)
+
+// History at the analysis rate for sources that can't be viewed in place
+// (the demo signal, decimated tracks), so the batch can look back over
+// ANALYSIS_SPAN samples
+#define ANALYSIS_RING_SIZE      2048
+#define ANALYSIS_RING_MASK      (ANALYSIS_RING_SIZE - 1)
+
+// Stereo frames split per pass while deinterleaving
+#define DEINTERLEAVE_CHUNK      256
+
+// Frames of BUFFER_SIZE replayed before a seek target: enough to fill the
+// Welch span behind the next frame, or every octave of the multires cascade
+#define SEEK_WELCH_BLOCKS       ((ANALYSIS_SPAN - 1) / BUFFER_SIZE)
+#define SEEK_MULTIRES_BLOCKS    ((MULTIRES_FFT_SIZE << (MULTIRES_OCTAVES - 1)) / BUFFER_SIZE)
+
+#if ANALYSIS_SPAN > ANALYSIS_RING_SIZE || BUFFER_SIZE % ANALYSIS_SEGMENTS
+#error "ANALYSIS_SEGMENTS must divide BUFFER_SIZE and its span fit the analysis ring"
+#endif
 static int fft_initialized = 0;
+static analysis_mode_t analysis_mode = ANALYSIS_MODE;
+
+static int16_t analysis_ring[ANALYSIS_RING_SIZE];         // Mono, or left
+static int16_t analysis_ring_right[ANALYSIS_RING_SIZE];   // Right of a stereo track
+static uint32_t analysis_write = 0;
+
+// Demo signal, synthesized when no track is playing
+static siggen_t demo_signal;
+static int demo_initialized = 0;
+
+// Anti-aliasing state for the track being decimated; restarted whenever the
+// track, its ratio or its position changes under us
+static decimator_t track_decimator;
+static decimator_t track_decimator_right;
+static const audio_track_t *decimated_track = NULL;
+static int decimated_position = -1;
 
 // WAV file header structure
 typedef struct {
@@ -34,12 +87,12 @@ typedef struct {
 // Initialize audio system
 int visualizer_audio_init(void) {
     // Initialize N64 audio system
-    audio_init(44100, 4);
+    audio_init(SAMPLE_RATE, 4);
     
+    // The track's own rate and channel count are logged once it is loaded
     #if DEBUG_ENABLED
     debugf("Audio system initialized\n");
-    debugf("- Sample rate: %d Hz\n", SAMPLE_RATE);
-    debugf("- Channels: %d\n", CHANNELS);
+    debugf("- Output rate: %d Hz\n", SAMPLE_RATE);
     debugf("- Buffer size: %d\n", BUFFER_SIZE);
     #endif
     
@@ -60,6 +113,8 @@ int audio_load_wav(const char *filename, audio_track_t *track) {
     track->length = 0;
     track->position = 0;
     track->playing = 0;
+    track->sample_rate = 0;
+    track->channels = 1;
     
     // In a real implementation, you would:
     // 1. Open the WAV file
@@ -111,60 +166,191 @@ void fft_init(void) {
         sin_table[i] = sinf(angle);
     }
     
+    // Bit-reversal permutation, applied while loading samples
+    int j = 0;
+    for (int i = 0; i < FFT_SIZE; i++) {
+        bitrev_table[i] = (uint16_t)j;
+        
+        int bit = FFT_SIZE >> 1;
+        while (j & bit) {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j ^= bit;
+    }
+    
     fft_initialized = 1;
+    fft_set_window(window_type);
+    filterbank_init();
     
     #if DEBUG_ENABLED
-    debugf("FFT initialized\n");
+    debugf("FFT initialized (window %d)\n", window_type);
     #endif
 }
 
-// Simple FFT implementation (Cooley-Tukey algorithm)
-void fft_compute(int16_t *samples, float *output, int size) {
-    if (!fft_initialized) fft_init();
+// Fill `table` with `size` points of a window, scaled to w[n] / (32768 * mean(w))
+// times `gain`
+static void fill_window(fft_window_t window, float *table, int size, float gain) {
+    double sum = 0.0;
     
-    // Convert input samples to complex numbers
-    static float real[FFT_SIZE];
-    static float imag[FFT_SIZE];
+    for (int i = 0; i < size; i++) {
+        float x = 2.0f * M_PI * i / size;
+        float w;
+        
+        switch (window) {
+            case FFT_WINDOW_HANN:
+                w = 0.5f - 0.5f * cosf(x);
+                break;
+            case FFT_WINDOW_BLACKMAN:
+                w = 0.42f - 0.5f * cosf(x) + 0.08f * cosf(2.0f * x);
+                break;
+            default:
+                w = 1.0f;
+                break;
+        }
+        
+        table[i] = w;
+        sum += w;
+    }
     
-    // Copy and normalize input
-    for (int i = 0; i < size && i < FFT_SIZE; i++) {
-        real[i] = (float)samples[i] / 32768.0f; // Normalize 16-bit samples
-        imag[i] = 0.0f;
+    float scale = (float)(size / sum) * gain / 32768.0f;
+    for (int i = 0; i < size; i++) {
+        table[i] *= scale;
     }
+}
+
+// Select the analysis window. The table holds w[n] / (32768 * mean(w)), so
+// normalization costs nothing and a full-scale sine keeps the same peak
+// magnitude whatever the window.
+void fft_set_window(fft_window_t window) {
+    if (window < 0 || window >= FFT_WINDOW_COUNT) window = FFT_WINDOW_RECTANGULAR;
     
-    // Zero pad if necessary
-    for (int i = size; i < FFT_SIZE; i++) {
-        real[i] = 0.0f;
-        imag[i] = 0.0f;
+    fill_window(window, window_table, FFT_SIZE, 1.0f);
+    window_type = window;
+}
+
+// Active window for a shorter transform of `size` points, with an extra
+// FFT_SIZE / size gain so a sine peaks at the same magnitude as in an
+// FFT_SIZE transform
+void fft_window_for_size(float *table, int size) {
+    fill_window(window_type, table, size, (float)FFT_SIZE / size);
+}
+
+fft_window_t fft_get_window(void) {
+    return window_type;
+}
+
+// View over a plain buffer
+void sample_view_from_buffer(sample_view_t *view, const int16_t *samples, int count) {
+    view->first = samples;
+    view->first_length = count;
+    view->second = NULL;
+    view->second_length = 0;
+}
+
+// View over a power-of-two ring buffer (e.g. a DMA ring), wrapping at mask + 1
+void sample_view_from_ring(sample_view_t *view, const int16_t *ring, uint32_t mask, uint32_t start, int count) {
+    int size = (int)mask + 1;
+    start &= mask;
+    if (count > size) count = size;
+    
+    view->first = &ring[start];
+    view->first_length = count < size - (int)start ? count : size - (int)start;
+    view->second = ring;
+    view->second_length = count - view->first_length;
+}
+
+// View over a looping track, wrapping back to the start at the end.
+// Position and count are in frames; an interleaved stereo track gives a
+// view of interleaved samples, two per frame.
+void sample_view_from_track(sample_view_t *view, const audio_track_t *track, int position, int count) {
+    int channels = track->channels == 2 ? 2 : 1;
+    if (count > track->length) count = track->length;
+    
+    int first = count < track->length - position ? count : track->length - position;
+    view->first = &track->samples[position * channels];
+    view->first_length = first * channels;
+    view->second = track->samples;
+    view->second_length = (count - first) * channels;
+}
+
+// Sub-window of a view starting `offset` samples in
+void sample_view_slice(sample_view_t *slice, const sample_view_t *view, int offset, int count) {
+    if (offset < view->first_length) {
+        int first = view->first_length - offset;
+        slice->first = view->first + offset;
+        slice->first_length = count < first ? count : first;
+        slice->second = view->second;
+        slice->second_length = count - slice->first_length;
+    } else {
+        sample_view_from_buffer(slice, view->second + (offset - view->first_length), count);
     }
     
-    // Bit-reversal
-    int j = 0;
-    for (int i = 1; i < FFT_SIZE; i++) {
-        int bit = FFT_SIZE >> 1;
-        while (j & bit) {
-            j ^= bit;
-            bit >>= 1;
-        }
-        j ^= bit;
-        
-        if (i < j) {
-            // Swap real[i] with real[j]
-            float temp = real[i];
-            real[i] = real[j];
-            real[j] = temp;
-            
-            // Swap imag[i] with imag[j]
-            temp = imag[i];
-            imag[i] = imag[j];
-            imag[j] = temp;
+    // Never read past the parent view
+    int available = view->first_length + view->second_length - offset;
+    if (slice->first_length + slice->second_length > available) {
+        int excess = slice->first_length + slice->second_length - available;
+        if (slice->second_length >= excess) {
+            slice->second_length -= excess;
+        } else {
+            slice->first_length -= excess - slice->second_length;
+            slice->second_length = 0;
         }
     }
+}
+
+// Gather the view, window + normalize and write in bit-reversed order
+static void fft_gather(const sample_view_t *view, float *dest) {
+    int i = 0;
     
-    // FFT computation
-    for (int len = 2; len <= FFT_SIZE; len <<= 1) {
+    for (int n = 0; n < view->first_length && i < FFT_SIZE; n++, i++) {
+        dest[bitrev_table[i]] = view->first[n] * window_table[i];
+    }
+    for (int n = 0; n < view->second_length && i < FFT_SIZE; n++, i++) {
+        dest[bitrev_table[i]] = view->second[n] * window_table[i];
+    }
+    
+    // Zero pad if necessary
+    for (; i < FFT_SIZE; i++) {
+        dest[bitrev_table[i]] = 0.0f;
+    }
+}
+
+// Load stage for one real signal
+static void fft_load(const sample_view_t *view, float *real, float *imag) {
+    fft_gather(view, real);
+    memset(imag, 0, FFT_SIZE * sizeof(float));
+}
+
+// Load stage for two real signals packed as real + imaginary parts
+static void fft_load_pair(const sample_view_t *left, const sample_view_t *right, float *real, float *imag) {
+    fft_gather(left, real);
+    fft_gather(right, imag);
+}
+
+// Split the spectrum of l + i*r into the powers of l and r (bins 0..N/2-1),
+// added to the accumulators: L[k] = (Z[k] + conj(Z[N-k])) / 2 and
+// R[k] = (Z[k] - conj(Z[N-k])) / 2i
+static void fft_accumulate_pair(const float *real, const float *imag, float *left_power, float *right_power) {
+    for (int k = 0; k < FFT_SIZE / 2; k++) {
+        int n = (FFT_SIZE - k) & (FFT_SIZE - 1);
+        
+        float lr = real[k] + real[n];
+        float li = imag[k] - imag[n];
+        float rr = imag[k] + imag[n];
+        float ri = real[k] - real[n];
+        
+        left_power[k] += 0.25f * (lr * lr + li * li);
+        right_power[k] += 0.25f * (rr * rr + ri * ri);
+    }
+}
+
+// In-place radix-2 butterflies over bit-reversed input of any power-of-two
+// size up to FFT_SIZE; shorter transforms stride through the twiddle tables
+static void fft_butterflies(float *real, float *imag, int size) {
+    for (int len = 2; len <= size; len <<= 1) {
         int step = FFT_SIZE / len;
-        for (int i = 0; i < FFT_SIZE; i += len) {
+        for (int i = 0; i < size; i += len) {
             for (int j = 0; j < len / 2; j++) {
                 int u = i + j;
                 int v = i + j + len / 2;
@@ -183,15 +369,111 @@ void fft_compute(int16_t *samples, float *output, int size) {
             }
         }
     }
+}
+
+// Butterfly stage for callers that load (and bit-reverse) their own input
+void fft_transform(float *real, float *imag, int size) {
+    if (!fft_initialized) fft_init();
+    
+    fft_butterflies(real, imag, size);
+}
+
+// FFT of FFT_SIZE samples read directly from a view; FFT_SIZE / 2 magnitudes out
+void fft_compute_view(const sample_view_t *view, float *output) {
+    if (!fft_initialized) fft_init();
+    
+    fft_load(view, fft_real, fft_imag);
+    fft_butterflies(fft_real, fft_imag, FFT_SIZE);
+    
+    for (int i = 0; i < FFT_SIZE / 2; i++) {
+        output[i] = sqrtf(fft_real[i] * fft_real[i] + fft_imag[i] * fft_imag[i]);
+    }
+}
+
+// Welch estimate: `count` windows starting every `hop` samples of the view,
+// their power spectra averaged and returned as RMS magnitudes (same scale as
+// fft_compute_view). Tables and scratch stay hot across the whole batch.
+void fft_compute_batch(const sample_view_t *view, int hop, int count, float *output) {
+    if (!fft_initialized) fft_init();
+    if (count < 1) count = 1;
+    
+    memset(fft_power, 0, sizeof(fft_power));
+    
+    for (int k = 0; k < count; k++) {
+        sample_view_t segment;
+        sample_view_slice(&segment, view, k * hop, FFT_SIZE);
+        
+        fft_load(&segment, fft_real, fft_imag);
+        fft_butterflies(fft_real, fft_imag, FFT_SIZE);
+        
+        for (int i = 0; i < FFT_SIZE / 2; i++) {
+            fft_power[i] += fft_real[i] * fft_real[i] + fft_imag[i] * fft_imag[i];
+        }
+    }
+    
+    float inv_count = 1.0f / count;
+    for (int i = 0; i < FFT_SIZE / 2; i++) {
+        output[i] = sqrtf(fft_power[i] * inv_count);
+    }
+}
+
+// Two channels through one complex FFT: same output as two fft_compute_view
+// calls for roughly the cost of one
+void fft_compute_stereo(const sample_view_t *left, const sample_view_t *right, float *left_out, float *right_out) {
+    fft_compute_batch_stereo(left, right, 0, 1, left_out, right_out);
+}
+
+// fft_compute_batch for a left/right pair, each window packed into one
+// complex transform
+void fft_compute_batch_stereo(const sample_view_t *left, const sample_view_t *right, int hop, int count,
+                              float *left_out, float *right_out) {
+    if (!fft_initialized) fft_init();
+    if (count < 1) count = 1;
+    
+    memset(fft_power, 0, sizeof(fft_power));
+    memset(fft_power_right, 0, sizeof(fft_power_right));
+    
+    for (int k = 0; k < count; k++) {
+        sample_view_t left_segment, right_segment;
+        sample_view_slice(&left_segment, left, k * hop, FFT_SIZE);
+        sample_view_slice(&right_segment, right, k * hop, FFT_SIZE);
+        
+        fft_load_pair(&left_segment, &right_segment, fft_real, fft_imag);
+        fft_butterflies(fft_real, fft_imag, FFT_SIZE);
+        fft_accumulate_pair(fft_real, fft_imag, fft_power, fft_power_right);
+    }
+    
+    float inv_count = 1.0f / count;
+    for (int i = 0; i < FFT_SIZE / 2; i++) {
+        left_out[i] = sqrtf(fft_power[i] * inv_count);
+        right_out[i] = sqrtf(fft_power_right[i] * inv_count);
+    }
+}
+
+// Simple FFT implementation (Cooley-Tukey algorithm)
+void fft_compute(int16_t *samples, float *output, int size) {
+    if (!fft_initialized) fft_init();
+    
+    sample_view_t view;
+    sample_view_from_buffer(&view, samples, size < FFT_SIZE ? size : FFT_SIZE);
+    
+    fft_load(&view, fft_real, fft_imag);
+    fft_butterflies(fft_real, fft_imag, FFT_SIZE);
     
     // Calculate magnitudes and store in output
     for (int i = 0; i < size / 2; i++) {
-        output[i] = sqrtf(real[i] * real[i] + imag[i] * imag[i]);
+        output[i] = sqrtf(fft_real[i] * fft_real[i] + fft_imag[i] * fft_imag[i]);
     }
 }
 
 // Convert FFT output to frequency bins for visualization
 void fft_to_frequency_bins(float *fft_output, float *frequency_bins, int fft_size, int num_bins) {
+    // Configured sizes go through the precomputed sparse filterbank
+    if (fft_size == FFT_SIZE && num_bins == NUM_FREQUENCY_BINS) {
+        filterbank_apply(fft_output, frequency_bins);
+        return;
+    }
+    
     int bin_size = (fft_size / 2) / num_bins;
     
     for (int i = 0; i < num_bins; i++) {
@@ -207,58 +489,269 @@ void fft_to_frequency_bins(float *fft_output, float *frequency_bins, int fft_siz
         frequency_bins[i] = sum / bin_size;
         
         // Apply logarithmic scaling for better visualization
-        frequency_bins[i] = logf(1.0f + frequency_bins[i] * 10.0f);
+        frequency_bins[i] = filterbank_log_scale(frequency_bins[i]);
     }
 }
 
-// Update audio and get frequency data
-void audio_update(audio_track_t *track, float *frequency_data) {
-    if (!track || !track->playing || !track->samples) {
-        // If no audio playing, generate demo pattern
-        static uint32_t demo_time = 0;
-        demo_time++;
+// Select the spectrum estimator; switching restarts the multires history
+void audio_set_analysis_mode(analysis_mode_t mode) {
+    if (mode != ANALYSIS_MULTIRES) mode = ANALYSIS_WELCH;
+    if (mode != analysis_mode) multires_reset();
+    analysis_mode = mode;
+}
+
+analysis_mode_t audio_get_analysis_mode(void) {
+    return analysis_mode;
+}
+
+// Push one frame of new samples through the octave cascade and band it
+static void analyze_multires(const sample_view_t *view, float *frequency_data) {
+    static float octave_output[MULTIRES_OUTPUT_SIZE];
+    
+    multires_compute(view, octave_output);
+    filterbank_apply_multires(octave_output, frequency_data);
+}
+
+// Track samples per analysis sample: 1, 2 or 4 (AUDIO_SAMPLE_RATE is the
+// analysis rate, tracks may be stored at 2x or 4x that)
+int audio_track_ratio(const audio_track_t *track) {
+    int rate = track->sample_rate ? track->sample_rate : AUDIO_SAMPLE_RATE;
+    int ratio = rate / AUDIO_SAMPLE_RATE;
+    
+    if (ratio * AUDIO_SAMPLE_RATE != rate || (ratio != 1 && ratio != 2 && ratio != 4)) {
+        return 1;   // Analyzed as-is, at the wrong rate
+    }
+    return ratio;
+}
+
+// Copy `count` samples into a ring at the shared write position
+static void ring_store(int16_t *ring, const int16_t *samples, int count) {
+    int first = ANALYSIS_RING_SIZE - (int)analysis_write;
+    if (first > count) first = count;
+    memcpy(&ring[analysis_write], samples, first * sizeof(int16_t));
+    memcpy(ring, &samples[first], (count - first) * sizeof(int16_t));
+}
+
+// Average of two band vectors, for a single spectrum from a stereo source
+static void bands_mid(const float *left, const float *right, float *mid) {
+    for (int i = 0; i < NUM_FREQUENCY_BINS; i++) {
+        mid[i] = 0.5f * (left[i] + right[i]);
+    }
+}
+
+// Band the analysis rings' most recent samples; `right_data` is only
+// filled for stereo sources
+static void analyze_rings(int stereo, float *frequency_data, float *right_data) {
+    static float ring_fft_output[FFT_SIZE];
+    static float ring_fft_right[FFT_SIZE];
+    sample_view_t view, right_view;
+    
+    // Multires only needs the new samples, it keeps its own history. It has
+    // a single cascade, so a stereo pair is analyzed as its mid signal.
+    if (analysis_mode == ANALYSIS_MULTIRES) {
+        static int16_t mid[BUFFER_SIZE];
+        uint32_t start = analysis_write - BUFFER_SIZE;
+        
+        if (stereo) {
+            for (int i = 0; i < BUFFER_SIZE; i++) {
+                uint32_t j = (start + i) & ANALYSIS_RING_MASK;
+                mid[i] = (int16_t)((analysis_ring[j] + analysis_ring_right[j]) >> 1);
+            }
+            sample_view_from_buffer(&view, mid, BUFFER_SIZE);
+        } else {
+            sample_view_from_ring(&view, analysis_ring, ANALYSIS_RING_MASK, start, BUFFER_SIZE);
+        }
         
-        for (int i = 0; i < NUM_FREQUENCY_BINS; i++) {
-            float freq = (float)i / NUM_FREQUENCY_BINS;
-            float time = demo_time * 0.1f;
+        analyze_multires(&view, frequency_data);
+        if (stereo && right_data) memcpy(right_data, frequency_data, NUM_FREQUENCY_BINS * sizeof(float));
+        return;
+    }
+    
+    sample_view_from_ring(&view, analysis_ring, ANALYSIS_RING_MASK, analysis_write - ANALYSIS_SPAN, ANALYSIS_SPAN);
+    if (!stereo) {
+        fft_compute_batch(&view, ANALYSIS_HOP, ANALYSIS_SEGMENTS, ring_fft_output);
+        fft_to_frequency_bins(ring_fft_output, frequency_data, FFT_SIZE, NUM_FREQUENCY_BINS);
+        return;
+    }
+    
+    static float left_bands[NUM_FREQUENCY_BINS];
+    static float right_bands[NUM_FREQUENCY_BINS];
+    
+    sample_view_from_ring(&right_view, analysis_ring_right, ANALYSIS_RING_MASK, analysis_write - ANALYSIS_SPAN, ANALYSIS_SPAN);
+    fft_compute_batch_stereo(&view, &right_view, ANALYSIS_HOP, ANALYSIS_SEGMENTS, ring_fft_output, ring_fft_right);
+    fft_to_frequency_bins(ring_fft_output, left_bands, FFT_SIZE, NUM_FREQUENCY_BINS);
+    fft_to_frequency_bins(ring_fft_right, right_bands, FFT_SIZE, NUM_FREQUENCY_BINS);
+    
+    if (right_data) {
+        memcpy(frequency_data, left_bands, sizeof(left_bands));
+        memcpy(right_data, right_bands, sizeof(right_bands));
+    } else {
+        bands_mid(left_bands, right_bands, frequency_data);
+    }
+}
+
+// Decimate BUFFER_SIZE * ratio track frames from `position` into the
+// analysis ring(s), splitting interleaved stereo on the way
+static void decimate_track(const audio_track_t *track, int position, int ratio) {
+    static int16_t decimated[BUFFER_SIZE];
+    static int16_t decimated_right[BUFFER_SIZE];
+    int stereo = track->channels == 2;
+    
+    if (track != decimated_track || position != decimated_position || track_decimator.ratio != ratio) {
+        decimator_init(&track_decimator, ratio);
+        decimator_init(&track_decimator_right, ratio);
+        decimated_track = track;
+    }
+    
+    int count = 0;
+    if (!stereo) {
+        sample_view_t view;
+        sample_view_from_track(&view, track, position, BUFFER_SIZE * ratio);
+        count = decimator_process(&track_decimator, view.first, view.first_length, decimated);
+        count += decimator_process(&track_decimator, view.second, view.second_length, &decimated[count]);
+    } else {
+        static int16_t left[DEINTERLEAVE_CHUNK];
+        static int16_t right[DEINTERLEAVE_CHUNK];
+        int total = BUFFER_SIZE * ratio;
+        
+        for (int done = 0; done < total; ) {
+            int frame = (position + done) % track->length;
+            int n = total - done;
+            if (n > DEINTERLEAVE_CHUNK) n = DEINTERLEAVE_CHUNK;
+            if (n > track->length - frame) n = track->length - frame;
             
-            // Create realistic audio spectrum simulation
-            float bass = sinf(time * 0.5f + freq * 2.0f) * 0.4f + 0.4f;
-            float mid = sinf(time * 0.8f + freq * 8.0f) * 0.3f + 0.3f;
-            float treble = cosf(time * 1.2f + freq * 15.0f) * 0.2f + 0.2f;
+            const int16_t *frames = &track->samples[2 * frame];
+            for (int i = 0; i < n; i++) {
+                left[i] = frames[2 * i];
+                right[i] = frames[2 * i + 1];
+            }
             
-            frequency_data[i] = bass + mid + treble;
+            decimator_process(&track_decimator_right, right, n, &decimated_right[count]);
+            count += decimator_process(&track_decimator, left, n, &decimated[count]);
+            done += n;
         }
+        
+        ring_store(analysis_ring_right, decimated_right, count);
+    }
+    
+    ring_store(analysis_ring, decimated, count);
+    analysis_write = (analysis_write + count) & ANALYSIS_RING_MASK;
+    decimated_position = (position + BUFFER_SIZE * ratio) % track->length;
+}
+
+// Update audio and get frequency data. A stereo track yields the mid of
+// its two channels' bands.
+void audio_update(audio_track_t *track, float *frequency_data) {
+    audio_update_stereo(track, frequency_data, NULL);
+}
+
+// Update audio and get per-channel frequency data; mono sources give the
+// same bands on both sides. `right_data` may be NULL.
+void audio_update_stereo(audio_track_t *track, float *frequency_data, float *right_data) {
+    if (!track || !track->playing || !track->samples) {
+        // If no audio playing, synthesize a demo signal and analyze it
+        // through the same FFT path as a real track
+        if (!demo_initialized) {
+            siggen_demo(&demo_signal, AUDIO_SAMPLE_RATE);
+            siggen_render(&demo_signal, analysis_ring, ANALYSIS_RING_SIZE);
+            demo_initialized = 1;
+        }
+        
+        // One frame's worth of audio, like the track path advances
+        int first = ANALYSIS_RING_SIZE - (int)analysis_write;
+        if (first > BUFFER_SIZE) first = BUFFER_SIZE;
+        siggen_render(&demo_signal, &analysis_ring[analysis_write], first);
+        siggen_render(&demo_signal, analysis_ring, BUFFER_SIZE - first);
+        analysis_write = (analysis_write + BUFFER_SIZE) & ANALYSIS_RING_MASK;
+        
+        analyze_rings(0, frequency_data, NULL);
+        if (right_data) memcpy(right_data, frequency_data, NUM_FREQUENCY_BINS * sizeof(float));
         return;
     }
     
-    // Get current audio samples
-    static int16_t current_samples[FFT_SIZE];
     static float fft_output[FFT_SIZE];
+    int ratio = audio_track_ratio(track);
     
-    // Copy samples from current position
-    int samples_to_copy = FFT_SIZE;
-    if (track->position + samples_to_copy > track->length) {
-        samples_to_copy = track->length - track->position;
+    if (ratio > 1 || track->channels == 2) {
+        // Full-rate or interleaved track: analyze a (decimated) copy covering
+        // the same time
+        decimate_track(track, track->position, ratio);
+        analyze_rings(track->channels == 2, frequency_data, right_data);
+    } else {
+        if (analysis_mode == ANALYSIS_MULTIRES) {
+            // Analyze every sample of this frame straight out of the track,
+            // wrapping around at the loop point
+            sample_view_t view;
+            sample_view_from_track(&view, track, track->position, BUFFER_SIZE);
+            analyze_multires(&view, frequency_data);
+        } else {
+            // The window ending with this frame's block, like the ring
+            // path analyzes after decimating it
+            int start = (track->position + BUFFER_SIZE - ANALYSIS_SPAN) % track->length;
+            if (start < 0) start += track->length;
+            
+            sample_view_t view;
+            sample_view_from_track(&view, track, start, ANALYSIS_SPAN);
+            fft_compute_batch(&view, ANALYSIS_HOP, ANALYSIS_SEGMENTS, fft_output);
+            
+            // Convert to frequency bins
+            fft_to_frequency_bins(fft_output, frequency_data, FFT_SIZE, NUM_FREQUENCY_BINS);
+        }
+        if (right_data) memcpy(right_data, frequency_data, NUM_FREQUENCY_BINS * sizeof(float));
     }
     
-    memcpy(current_samples, &track->samples[track->position], samples_to_copy * sizeof(int16_t));
-    
-    // Zero pad if necessary
-    if (samples_to_copy < FFT_SIZE) {
-        memset(&current_samples[samples_to_copy], 0, (FFT_SIZE - samples_to_copy) * sizeof(int16_t));
+    // Advance audio position by one frame of wall-clock time
+    track->position += BUFFER_SIZE * ratio;
+    if (track->position >= track->length) {
+        track->position %= track->length; // Loop, keeping the phase
     }
+}
+
+// Move playback to `position` (frames, wrapped into the track) and nothing
+// else: the analysis state is left as it is. Cheap enough for every frame
+// of a scrub; audio_seek once it ends.
+void audio_set_position(audio_track_t *track, int position) {
+    if (!track || !track->samples || track->length <= 0) return;
     
-    // Compute FFT
-    fft_compute(current_samples, fft_output, FFT_SIZE);
+    position %= track->length;
+    if (position < 0) position += track->length;
+    track->position = position;
+}
+
+// Jump to `position` (frames, wrapped into the track). The blocks just
+// before it are pushed through the decimators and the multires cascade
+// now, so the next audio_update analyzes the new spot with warm filters and
+// a full window instead of ramping up over several frames. The track is
+// random-access, so the cost is a fixed few blocks wherever the target is.
+void audio_seek(audio_track_t *track, int position) {
+    static float scratch[NUM_FREQUENCY_BINS];
     
-    // Convert to frequency bins
-    fft_to_frequency_bins(fft_output, frequency_data, FFT_SIZE, NUM_FREQUENCY_BINS);
+    if (!track || !track->samples || track->length <= 0) return;
     
-    // Advance audio position
-    track->position += BUFFER_SIZE;
-    if (track->position >= track->length) {
-        track->position = 0; // Loop
+    audio_set_position(track, position);
+    position = track->position;
+    
+    int ratio = audio_track_ratio(track);
+    int ring = ratio > 1 || track->channels == 2;
+    int multires = analysis_mode == ANALYSIS_MULTIRES;
+    int blocks = multires ? SEEK_MULTIRES_BLOCKS : (ring ? SEEK_WELCH_BLOCKS : 0);
+    
+    // Mono tracks at the analysis rate are viewed in place: Welch needs
+    // nothing, the cascade only its history
+    if (multires) multires_reset();
+    
+    for (int b = blocks; b > 0; b--) {
+        int start = (position - b * BUFFER_SIZE * ratio) % track->length;
+        if (start < 0) start += track->length;
+        
+        if (ring) {
+            decimate_track(track, start, ratio);
+            if (multires) analyze_rings(track->channels == 2, scratch, NULL);
+        } else {
+            sample_view_t view;
+            sample_view_from_track(&view, track, start, BUFFER_SIZE);
+            analyze_multires(&view, scratch);
+        }
     }
 }
 
@@ -4,21 +4,49 @@
 #include <stdint.h>
 
 // Audio configuration
-#define SAMPLE_RATE         44100
+#define SAMPLE_RATE         44100   // Output (audio_init) rate, not the track's
 #define SAMPLE_BITS         16
-#define CHANNELS            1       // Mono
 #define BUFFER_SIZE         1024
 #define FFT_SIZE            512
 #define NUM_FREQUENCY_BINS  64
 
+// Multi-resolution analysis: one MULTIRES_FFT_SIZE transform per octave
+#define MULTIRES_FFT_SIZE   128
+#define MULTIRES_OCTAVES    6
+
+// Spectrum estimator used by audio_update
+typedef enum {
+    ANALYSIS_WELCH,             // Overlapping FFT_SIZE windows, averaged
+    ANALYSIS_MULTIRES           // Half-band octave cascade, short FFT per octave
+} analysis_mode_t;
+
 // Audio data structures
 typedef struct {
     int16_t *samples;
     int length;
     int position;
     int playing;
+    int sample_rate;            // 0 = AUDIO_SAMPLE_RATE; 2x / 4x are decimated for analysis
+    int channels;               // 0 / 1 = mono, 2 = interleaved L/R (length, position in frames)
 } audio_track_t;
 
+// Read-only window of consecutive samples that may wrap around the end of
+// its source: `first` continues into `second`. No samples are copied.
+typedef struct {
+    const int16_t *first;
+    int first_length;
+    const int16_t *second;
+    int second_length;
+} sample_view_t;
+
+// Analysis window applied in the FFT load stage
+typedef enum {
+    FFT_WINDOW_RECTANGULAR,
+    FFT_WINDOW_HANN,
+    FFT_WINDOW_BLACKMAN,
+    FFT_WINDOW_COUNT
+} fft_window_t;
+
 typedef struct {
     float magnitude;
     float phase;
@@ -29,12 +57,33 @@ int visualizer_audio_init(void);
 int audio_load_wav(const char *filename, audio_track_t *track);
 void audio_play(audio_track_t *track);
 void audio_stop(audio_track_t *track);
+void audio_set_position(audio_track_t *track, int position);
+void audio_seek(audio_track_t *track, int position);
 void audio_update(audio_track_t *track, float *frequency_data);
+void audio_update_stereo(audio_track_t *track, float *frequency_data, float *right_data);
 void audio_cleanup(audio_track_t *track);
+int audio_track_ratio(const audio_track_t *track);
+void audio_set_analysis_mode(analysis_mode_t mode);
+analysis_mode_t audio_get_analysis_mode(void);
 
 // FFT functions
 void fft_init(void);
+void fft_set_window(fft_window_t window);
+fft_window_t fft_get_window(void);
 void fft_compute(int16_t *samples, float *output, int size);
+void fft_compute_view(const sample_view_t *view, float *output);
+void fft_compute_batch(const sample_view_t *view, int hop, int count, float *output);
+void fft_compute_stereo(const sample_view_t *left, const sample_view_t *right, float *left_out, float *right_out);
+void fft_compute_batch_stereo(const sample_view_t *left, const sample_view_t *right, int hop, int count,
+                              float *left_out, float *right_out);
+void fft_window_for_size(float *table, int size);
+void fft_transform(float *real, float *imag, int size);
 void fft_to_frequency_bins(float *fft_output, float *frequency_bins, int fft_size, int num_bins);
 
+// Sample views
+void sample_view_from_buffer(sample_view_t *view, const int16_t *samples, int count);
+void sample_view_from_ring(sample_view_t *view, const int16_t *ring, uint32_t mask, uint32_t start, int count);
+void sample_view_from_track(sample_view_t *view, const audio_track_t *track, int position, int count);
+void sample_view_slice(sample_view_t *slice, const sample_view_t *view, int offset, int count);
+
 #endif // AUDIO_H 
\ No newline at end of file
@@ -0,0 +1,179 @@
+#include "bars.h"
+#include <math.h>
+#include <string.h>
+#include "config.h"
+#include "filterbank.h"
+
+// Bars are split per channel: [0] grows up from the center line (left),
+// [1] grows down (right)
+static float bar_heights[2][NUM_BARS];
+static float bar_velocities[2][NUM_BARS];
+
+static const visualizer_state_t *bars_state = 0;
+static surface_t *disp = 0;
+static float band_scale;        // Band level -> 0..1 of full scale
+
+// Layout is in screen coordinates; the target may be a reduced surface
+#define TARGET_X(x)             ((x) * disp->width / SCREEN_WIDTH)
+#define TARGET_Y(y)             ((y) * disp->height / SCREEN_HEIGHT)
+
+static void bars_init(const visualizer_state_t *state) {
+    bars_state = state;
+    band_scale = 1.0f / filterbank_full_scale();
+    memset(bar_heights, 0, sizeof(bar_heights));
+    memset(bar_velocities, 0, sizeof(bar_velocities));
+}
+
+// Bar physics: move each bar towards its band's level
+static void bars_update(const visualizer_state_t *state) {
+    for (int c = 0; c < 2; c++) {
+        float *heights = bar_heights[c];
+        float *velocities = bar_velocities[c];
+        
+        for (int i = 0; i < NUM_BARS && i < NUM_FREQUENCY_BINS; i++) {
+            // Scale frequency data to bar height
+            float target_height = state->channels[c][i] * band_scale * MAX_BAR_HEIGHT * BAR_GAIN;
+            
+            // Smooth animation with improved physics
+            float diff = target_height - heights[i];
+            velocities[i] += diff * RESPONSE_SPEED;
+            velocities[i] *= DAMPING_FACTOR;
+            
+            // A settled bar's velocity would decay into denormals: slow on
+            // the host, an unimplemented-operation trap on the VR4300 FPU
+            if (fabsf(velocities[i]) < 1e-4f) velocities[i] = 0.0f;
+            heights[i] += velocities[i];
+            
+            // Clamp values
+            heights[i] = CLAMP(heights[i], MIN_BAR_HEIGHT, MAX_BAR_HEIGHT);
+        }
+    }
+}
+
+// After a seek, jump straight to the new levels instead of animating there
+static void bars_seek(const visualizer_state_t *state) {
+    for (int c = 0; c < 2; c++) {
+        for (int i = 0; i < NUM_BARS && i < NUM_FREQUENCY_BINS; i++) {
+            float target_height = state->channels[c][i] * band_scale * MAX_BAR_HEIGHT * BAR_GAIN;
+            bar_heights[c][i] = CLAMP(target_height, MIN_BAR_HEIGHT, MAX_BAR_HEIGHT);
+            bar_velocities[c][i] = 0.0f;
+        }
+    }
+}
+
+void update_bars(void) {
+    bars_update(bars_state);
+}
+
+// Get neon color based on frequency and intensity
+uint16_t get_neon_color(int bar_index, float intensity) {
+    // Color cycle sweeps across the bars once per beat
+    float phase = (float)bar_index / NUM_BARS + bars_state->beat->phase;
+    float cycle = sinf(phase * 3.14159f * 2.0f) * 0.5f + 0.5f;
+    
+    // Add audio-reactive color changes
+    float audio_influence = 0.0f;
+    if (bar_index < NUM_FREQUENCY_BINS) {
+        audio_influence = bars_state->bands[bar_index] * band_scale;
+    }
+    
+    // Combine intensity with audio data
+    float total_intensity = (intensity + audio_influence) * 0.5f;
+    
+    // Choose color based on intensity and position
+    if (total_intensity < INTENSITY_LOW_THRESHOLD) {
+        return COLOR_TEAL;
+    } else if (total_intensity < INTENSITY_HIGH_THRESHOLD) {
+        // Blend between teal and purple based on cycle and audio
+        return (cycle + audio_influence) > 0.5f ? COLOR_PURPLE : COLOR_TEAL;
+    } else {
+        // High intensity - use pink or purple based on cycle and audio
+        return (cycle + audio_influence) > 0.3f ? COLOR_PINK : COLOR_PURPLE;
+    }
+}
+
+// Draw a glowing line with neon effect
+void draw_neon_line(int x1, int y1, int x2, int y2, uint16_t color) {
+    // Draw main line
+    graphics_draw_line(disp, x1, y1, x2, y2, color);
+    
+    #if GLOW_ENABLED
+    // Add glow effect by drawing additional lines
+    if (x1 > 0 && x2 > 0) {
+        graphics_draw_line(disp, x1-1, y1, x2-1, y2, color);
+    }
+    if (x1 < disp->width-1 && x2 < disp->width-1) {
+        graphics_draw_line(disp, x1+1, y1, x2+1, y2, color);
+    }
+    if (y1 > 0 && y2 > 0) {
+        graphics_draw_line(disp, x1, y1-1, x2, y2-1, color);
+    }
+    if (y1 < disp->height-1 && y2 < disp->height-1) {
+        graphics_draw_line(disp, x1, y1+1, x2, y2+1, color);
+    }
+    #endif
+}
+
+// Mirrored neon bars around the center line
+static void bars_render(surface_t *surface, const visualizer_state_t *state) {
+    disp = surface;
+    
+    // Clear screen, unless drawing over the feedback trails
+    if (!state->feedback) {
+        graphics_fill_screen(disp, COLOR_BLACK);
+    }
+    
+    // The offset-line glow is 3 px wide; on a reduced target whose bars sit
+    // closer than that it would merge them, so they are drawn plain
+    int plain = state->feedback || state->bloom || TARGET_X(BAR_WIDTH) < 4 ||
+                state->quality >= QUALITY_NO_GLOW;
+    int step = state->quality >= QUALITY_HALF_BARS ? 2 : 1;
+    
+    // Draw frequency bars as neon lines
+    for (int i = 0; i < NUM_BARS; i += step) {
+        int x = TARGET_X(i * BAR_WIDTH + BAR_WIDTH / 2);
+        float intensity = (bar_heights[0][i] + bar_heights[1][i]) * 0.5f / MAX_BAR_HEIGHT;
+        
+        uint16_t color = get_neon_color(i, intensity);
+        
+        // Left channel up from the center, right channel down
+        int top_y = TARGET_Y(CENTER_Y - (int)bar_heights[0][i] / 2);
+        int bottom_y = TARGET_Y(CENTER_Y + (int)bar_heights[1][i] / 2);
+        
+        // Draw main bar; trails and bloom replace the offset-line glow
+        if (plain) {
+            graphics_draw_line(disp, x, top_y, x, bottom_y, color);
+        } else {
+            draw_neon_line(x, top_y, x, bottom_y, color);
+        }
+        
+        #if FLOW_LINES_ENABLED
+        // Add connecting lines for flow effect
+        if (i > 0 && state->quality < QUALITY_NO_FLOW) {
+            int prev_x = TARGET_X((i-step) * BAR_WIDTH + BAR_WIDTH / 2);
+            int prev_top_y = TARGET_Y(CENTER_Y - (int)bar_heights[0][i-step] / 2);
+            int prev_bottom_y = TARGET_Y(CENTER_Y + (int)bar_heights[1][i-step] / 2);
+            
+            // Connect tops and bottoms with flowing lines
+            graphics_draw_line(disp, prev_x, prev_top_y, x, top_y, color);
+            graphics_draw_line(disp, prev_x, prev_bottom_y, x, bottom_y, color);
+        }
+        #endif
+    }
+    
+    #if CENTER_LINE_ENABLED
+    // Add center line with audio reactivity, flashing on the beat
+    uint16_t center_color = (state->avg_intensity > 0.5f || state->beat->pulse > 0.5f) ? COLOR_PINK : COLOR_TEAL;
+    graphics_draw_line(disp, 0, TARGET_Y(CENTER_Y), disp->width, TARGET_Y(CENTER_Y), center_color);
+    #endif
+}
+
+const visualizer_mode_desc_t bars_mode = {
+    "bars",
+    bars_init,
+    NULL,
+    bars_seek,
+    bars_update,
+    bars_render,
+    RENDER_160x120,
+};
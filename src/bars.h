@@ -0,0 +1,15 @@
+#ifndef BARS_H
+#define BARS_H
+
+#include "mode.h"
+
+// Mirrored neon bars: the left channel grows up from the center line, the
+// right channel grows down; mono sources drive both alike
+extern const visualizer_mode_desc_t bars_mode;
+
+// Function prototypes
+void update_bars(void);
+uint16_t get_neon_color(int bar_index, float intensity);
+void draw_neon_line(int x1, int y1, int x2, int y2, uint16_t color);
+
+#endif // BARS_H
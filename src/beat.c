@@ -0,0 +1,138 @@
+#include "beat.h"
+#include "config.h"
+#include "platform.h"
+#include <math.h>
+#include <string.h>
+
+#define BEAT_MASK               (BEAT_HISTORY - 1)
+
+// Flux statistics follow the music over ~0.5 s; an onset must clear the
+// mean by this many mean deviations
+#define FLUX_SMOOTHING          0.1f
+#define ONSET_THRESHOLD         1.5f
+#define ONSET_FLOOR             0.01f
+
+// Autocorrelation memory: ~0.99 per frame keeps the last few seconds
+#define ACF_DECAY               0.99f
+
+// How hard tempo and phase are pulled towards the measurements
+#define PERIOD_SMOOTHING        0.1f
+#define PHASE_CORRECTION        0.2f
+
+#define PULSE_DECAY             0.8f
+
+void beat_init(beat_tracker_t *tracker, float frame_rate) {
+    memset(tracker, 0, sizeof(*tracker));
+    tracker->frame_rate = frame_rate;
+    
+    // Lags covering BEAT_MIN_BPM..BEAT_MAX_BPM at this frame rate
+    tracker->min_lag = (int)(frame_rate * 60.0f / BEAT_MAX_BPM);
+    tracker->max_lag = (int)ceilf(frame_rate * 60.0f / BEAT_MIN_BPM);
+    if (tracker->min_lag < 2) tracker->min_lag = 2;
+    if (tracker->max_lag > BEAT_HISTORY - 1) tracker->max_lag = BEAT_HISTORY - 1;
+    if (tracker->max_lag - tracker->min_lag >= BEAT_MAX_LAGS) {
+        tracker->max_lag = tracker->min_lag + BEAT_MAX_LAGS - 1;
+    }
+    
+    // Log-Gaussian around 120 BPM, one octave wide, to settle octave errors
+    for (int lag = tracker->min_lag; lag <= tracker->max_lag; lag++) {
+        float octaves = log2f(60.0f * frame_rate / lag / 120.0f);
+        tracker->prior[lag - tracker->min_lag] = expf(-0.5f * octaves * octaves);
+    }
+    
+    tracker->period = frame_rate * 0.5f;
+    tracker->bpm = 120.0f;
+}
+
+// Strongest lag, refined to a fractional period by a parabola through its
+// neighbours; 0 while there's no periodicity yet
+static float best_period(const beat_tracker_t *tracker) {
+    int lags = tracker->max_lag - tracker->min_lag + 1;
+    int best = -1;
+    float best_score = 0.0f;
+    
+    for (int i = 0; i < lags; i++) {
+        float score = tracker->acf[i] * tracker->prior[i];
+        if (score > best_score) {
+            best_score = score;
+            best = i;
+        }
+    }
+    if (best < 0) return 0.0f;
+    
+    float offset = 0.0f;
+    if (best > 0 && best < lags - 1) {
+        float a = tracker->acf[best - 1];
+        float b = tracker->acf[best];
+        float c = tracker->acf[best + 1];
+        float denom = a - 2.0f * b + c;
+        if (denom < 0.0f) offset = 0.5f * (a - c) / denom;
+    }
+    
+    return tracker->min_lag + best + offset;
+}
+
+// Feed one frame's band vector (NUM_FREQUENCY_BINS log levels)
+void beat_update(beat_tracker_t *tracker, const float *bands) {
+    // Half-wave-rectified spectral flux: only rising bands count
+    float flux = 0.0f;
+    if (tracker->has_previous) {
+        for (int b = 0; b < NUM_FREQUENCY_BINS; b++) {
+            float rise = bands[b] - tracker->previous[b];
+            if (rise > 0.0f) flux += rise;
+        }
+        flux *= 1.0f / NUM_FREQUENCY_BINS;
+    }
+    memcpy(tracker->previous, bands, sizeof(tracker->previous));
+    tracker->has_previous = 1;
+    
+    // Adaptive threshold, then a refractory period of half the shortest beat
+    float threshold = tracker->flux_mean + ONSET_THRESHOLD * tracker->flux_deviation + ONSET_FLOOR;
+    int onset = flux > threshold && flux >= tracker->last_flux &&
+                tracker->frames_since_onset >= tracker->min_lag / 2;
+    
+    float strength = flux - tracker->flux_mean;
+    if (strength < 0.0f) strength = 0.0f;
+    
+    tracker->flux_deviation += FLUX_SMOOTHING * (fabsf(flux - tracker->flux_mean) - tracker->flux_deviation);
+    tracker->flux_mean += FLUX_SMOOTHING * (flux - tracker->flux_mean);
+    tracker->last_flux = flux;
+    tracker->frames_since_onset = onset ? 0 : tracker->frames_since_onset + 1;
+    tracker->onset = onset ? strength : 0.0f;
+    
+    // One new product per lag against the onset ring
+    uint32_t write = tracker->write;
+    tracker->history[write & BEAT_MASK] = strength;
+    for (int lag = tracker->min_lag; lag <= tracker->max_lag; lag++) {
+        float *acf = &tracker->acf[lag - tracker->min_lag];
+        *acf = *acf * ACF_DECAY + strength * tracker->history[(write - lag) & BEAT_MASK];
+    }
+    tracker->write = write + 1;
+    
+    float period = best_period(tracker);
+    if (period > 0.0f) {
+        tracker->period += PERIOD_SMOOTHING * (period - tracker->period);
+        tracker->bpm = 60.0f * tracker->frame_rate / tracker->period;
+    }
+    
+    // Advance the beat phase, nudging it towards 0 at every onset
+    tracker->pulse *= PULSE_DECAY;
+    tracker->phase += 1.0f / tracker->period;
+    if (onset) {
+        float error = tracker->phase < 0.5f ? tracker->phase : tracker->phase - 1.0f;
+        tracker->phase -= PHASE_CORRECTION * error;
+    }
+    
+    tracker->beat = 0;
+    if (tracker->phase >= 1.0f) {
+        tracker->phase -= 1.0f;
+        tracker->beat = 1;
+        tracker->pulse = 1.0f;
+    }
+}
+
+// The next band vector follows a jump in the audio: don't count the jump as
+// an onset. Tempo and phase carry on.
+void beat_seek(beat_tracker_t *tracker) {
+    tracker->has_previous = 0;
+}
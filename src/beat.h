@@ -0,0 +1,59 @@
+#ifndef BEAT_H
+#define BEAT_H
+
+#include <stdint.h>
+#include "audio.h"
+
+// =============================================================================
+// Onset and beat tracking
+//
+// Works on the band vectors the analyzer already produces, one per frame:
+// half-wave-rectified spectral flux against an adaptive threshold gives the
+// onsets, and a leaky autocorrelation over a fixed ring of onset strengths,
+// updated a lag at a time, gives the tempo. A phase accumulator locked to the
+// detected onsets exposes where we are inside the current beat. The per-frame
+// cost is bounded (NUM_FREQUENCY_BINS + at most BEAT_MAX_LAGS multiply-adds)
+// and no samples are touched, so precomputed band data feeds it for free.
+// =============================================================================
+
+#define BEAT_HISTORY            64      // Onset ring, power of two > lag range
+#define BEAT_MIN_BPM            60
+#define BEAT_MAX_BPM            180
+#define BEAT_MAX_LAGS           48
+
+typedef struct {
+    float frame_rate;           // Band vectors per second
+    float previous[NUM_FREQUENCY_BINS];     // Last band vector
+    int has_previous;
+    
+    // Adaptive threshold: running mean and mean deviation of the flux
+    float flux_mean;
+    float flux_deviation;
+    float last_flux;
+    int frames_since_onset;
+    
+    // Onset strength ring and its autocorrelation, lag by lag
+    float history[BEAT_HISTORY];
+    uint32_t write;
+    int min_lag;
+    int max_lag;
+    float acf[BEAT_MAX_LAGS];
+    float prior[BEAT_MAX_LAGS]; // Tempo preference, centered on 120 BPM
+    
+    // Tempo and phase
+    float period;               // Frames per beat
+    float phase;                // 0..1 within the current beat
+    
+    // Read by the renderer
+    float bpm;
+    float onset;                // This frame's onset strength (0 = none)
+    float pulse;                // 1 on a beat, decaying to 0
+    int beat;                   // 1 on the frame a beat starts
+} beat_tracker_t;
+
+// Function prototypes
+void beat_init(beat_tracker_t *tracker, float frame_rate);
+void beat_update(beat_tracker_t *tracker, const float *bands);
+void beat_seek(beat_tracker_t *tracker);
+
+#endif // BEAT_H
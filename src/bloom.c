@@ -0,0 +1,77 @@
+#include "bloom.h"
+#include "config.h"
+
+static surface_t half;          // SCREEN / 2
+static surface_t quarter;       // SCREEN / 4, blurred in place
+
+// Allocate both reduction surfaces on first use (38 KB + 9.6 KB)
+void bloom_init(void) {
+    if (!half.buffer) half = surface_alloc(FMT_RGBA16, SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2);
+    if (!quarter.buffer) quarter = surface_alloc(FMT_RGBA16, BLOOM_WIDTH, BLOOM_HEIGHT);
+}
+
+// Bilinear 2:1 reduction of src into dst
+static void downsample(surface_t *dst, const surface_t *src) {
+    rdpq_attach(dst, NULL);
+    rdpq_set_mode_standard();
+    rdpq_mode_filter(FILTER_BILINEAR);
+    rdpq_tex_blit(src, 0, 0, &(rdpq_blitparms_t){ .scale_x = 0.5f, .scale_y = 0.5f });
+    rdpq_detach_wait();
+}
+
+// One box pass over `count` RGBA5551 pixels `step` apart, through a running
+// sum per channel; edges repeat the border pixel. Every output texel is
+// opaque, since the additive blender weights it by its alpha.
+static void box_pass(uint16_t *pixels, int count, int step) {
+    static uint16_t line[SCREEN_WIDTH];
+    const int taps = 2 * BLOOM_RADIUS + 1;
+    int r = 0, g = 0, b = 0;
+    
+    for (int i = 0; i < count; i++) line[i] = pixels[i * step];
+    
+    for (int k = -BLOOM_RADIUS; k <= BLOOM_RADIUS; k++) {
+        uint16_t c = line[CLAMP(k, 0, count - 1)];
+        r += c >> 11;
+        g += (c >> 6) & 0x1F;
+        b += (c >> 1) & 0x1F;
+    }
+    
+    for (int i = 0; i < count; i++) {
+        pixels[i * step] = (uint16_t)(((r / taps) << 11) | ((g / taps) << 6) | ((b / taps) << 1) | 1);
+        
+        uint16_t in = line[CLAMP(i + BLOOM_RADIUS + 1, 0, count - 1)];
+        uint16_t out = line[CLAMP(i - BLOOM_RADIUS, 0, count - 1)];
+        r += (in >> 11) - (out >> 11);
+        g += ((in >> 6) & 0x1F) - ((out >> 6) & 0x1F);
+        b += ((in >> 1) & 0x1F) - ((out >> 1) & 0x1F);
+    }
+}
+
+// Separable box blur of a small RGBA5551 surface, rows then columns
+void bloom_blur(surface_t *surface) {
+    int pitch = surface->stride / 2;
+    uint16_t *pixels = (uint16_t *)surface->buffer;
+    
+    for (int y = 0; y < surface->height; y++) {
+        box_pass(&pixels[y * pitch], surface->width, 1);
+    }
+    for (int x = 0; x < surface->width; x++) {
+        box_pass(&pixels[x], surface->height, pitch);
+    }
+}
+
+// Reduce, blur and add the frame's glow back onto it
+void bloom_apply(surface_t *frame) {
+    downsample(&half, frame);
+    downsample(&quarter, &half);
+    bloom_blur(&quarter);
+    
+    rdpq_attach(frame, NULL);
+    rdpq_set_mode_standard();
+    rdpq_mode_combiner(RDPQ_COMBINER_TEX_FLAT);
+    rdpq_set_prim_color(RGBA32(BLOOM_STRENGTH, BLOOM_STRENGTH, BLOOM_STRENGTH, 0xFF));
+    rdpq_mode_blender(RDPQ_BLENDER_ADDITIVE);
+    rdpq_mode_filter(FILTER_BILINEAR);
+    rdpq_tex_blit(&quarter, 0, 0, &(rdpq_blitparms_t){ .scale_x = 4.0f, .scale_y = 4.0f });
+    rdpq_detach_wait();
+}
@@ -0,0 +1,30 @@
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include "platform.h"
+
+// =============================================================================
+// Bloom
+//
+// Everything the mode drew is emissive (the background is black), so the
+// frame itself is the bloom source. The RDP halves it twice with bilinear
+// filtering down to BLOOM_WIDTH x BLOOM_HEIGHT, the CPU runs a separable
+// box blur over those 4800 pixels, and the RDP adds the result back,
+// upscaled bilinearly, over the frame. The cost is fixed per frame,
+// whatever and however much was drawn.
+//
+// Only checked against the host stub so far: the RDP's bilinear sample
+// positions and its additive blend of 5551 texels still need a look on
+// hardware or an accurate emulator (ares).
+// =============================================================================
+
+#define BLOOM_WIDTH             (SCREEN_WIDTH / 4)
+#define BLOOM_HEIGHT            (SCREEN_HEIGHT / 4)
+#define BLOOM_RADIUS            2       // Box half-width, in bloom pixels
+
+// Function prototypes
+void bloom_init(void);
+void bloom_apply(surface_t *frame);
+void bloom_blur(surface_t *surface);
+
+#endif // BLOOM_H
@@ -11,7 +11,9 @@
 #define CENTER_Y                (SCREEN_HEIGHT / 2)
 
 // Configurações do Visualizer
+#ifndef NUM_BARS
 #define NUM_BARS                64      // Número de barras de frequência
+#endif
 #define BAR_WIDTH               (SCREEN_WIDTH / NUM_BARS)
 #define MAX_BAR_HEIGHT          (SCREEN_HEIGHT - 40)
 #define MIN_BAR_HEIGHT          5
@@ -20,8 +22,9 @@
 #define ANIMATION_SPEED         0.1f    // Velocidade base da animação
 #define DAMPING_FACTOR          0.85f   // Suavização da animação (0.0-1.0)
 #define RESPONSE_SPEED          0.1f    // Velocidade de resposta às mudanças
+#define BAR_GAIN                1.0f    // Ganho sobre a escala cheia (1.0: um seno em escala cheia enche a barra)
 
-// Configurações de Cores (RGB565)
+// Configurações de Cores (RGBA5551, bit 0 = alpha)
 #define COLOR_PURPLE            0x801F  // Roxo neon
 #define COLOR_PINK              0xF81F  // Rosa neon  
 #define COLOR_TEAL              0x07FF  // Teal blue neon
@@ -33,8 +36,30 @@
 #define INTENSITY_HIGH_THRESHOLD    0.7f    // Rosa para altas frequências
 
 // Configurações de Efeitos
+#ifndef GLOW_ENABLED
 #define GLOW_ENABLED            1       // Ativar efeito de glow (0/1)
+#endif
+#ifndef FLOW_LINES_ENABLED
 #define FLOW_LINES_ENABLED      1       // Ativar linhas de conexão (0/1)
+#endif
+#ifndef VISUALIZER_MODE
+#define VISUALIZER_MODE         VISUALIZER_BARS // Visão inicial (BARS/WATERFALL/SCOPE/RADIAL)
+#endif
+#ifndef FEEDBACK_ENABLED
+#define FEEDBACK_ENABLED        0       // Rastro: mistura o frame anterior escurecido (0/1, botão B)
+#endif
+#define FEEDBACK_DECAY          192     // Quanto do frame anterior fica a cada frame (0-255)
+#ifndef BLOOM_ENABLED
+#define BLOOM_ENABLED           0       // Bloom: brilho borrado em 1/4 da resolução somado ao frame (0/1, botão A)
+#endif
+#define BLOOM_STRENGTH          160     // Intensidade do bloom somado (0-255)
+#ifndef GOVERNOR_ENABLED
+#define GOVERNOR_ENABLED        1       // Desliga efeitos em tempo real quando o frame estoura o orçamento (0/1)
+#endif
+#define GOVERNOR_BUDGET_US      16667   // Orçamento de trabalho por frame (60 fps)
+#ifndef RENDER_RESOLUTION
+#define RENDER_RESOLUTION       0       // Resolução de render dos modos: 0 = 320x240, 1 = 256x192, 2 = 160x120 (C-cima/C-baixo)
+#endif
 #define CENTER_LINE_ENABLED     1       // Ativar linha central (0/1)
 #define TITLE_ENABLED           1       // Mostrar título (0/1)
 
@@ -43,12 +68,33 @@
 #define VSYNC_ENABLED           1       // Ativar VSync (0/1)
 
 // Configurações de Áudio (para implementação futura)
-#define AUDIO_SAMPLE_RATE       22050   // Taxa de amostragem (real audio)
+#define AUDIO_SAMPLE_RATE       22050   // Taxa de análise (faixas a 2x/4x disso são decimadas)
 #define AUDIO_BUFFER_SIZE       512     // Tamanho do buffer de áudio
+#define SEEK_STEP_MS            5000    // Salto do D-pad (ms)
+#define SCRUB_SPEED             8       // Velocidade do scrub (Z + D-pad), em x tempo real
+#ifndef TRACK_HEADER
+#define TRACK_HEADER            "intensidade-intro-mono-22050_data.h"   // Faixa embutida (make TRACK=...)
+#endif
+#ifndef ANALYSIS_SEGMENTS
+#define ANALYSIS_SEGMENTS       4       // FFTs sobrepostas por frame (média de Welch, 1 = FFT única)
+#endif
+#ifndef ANALYSIS_MODE
+#define ANALYSIS_MODE           ANALYSIS_WELCH  // Análise (WELCH = FFT de 512, MULTIRES = uma FFT curta por oitava)
+#endif
+#ifndef FILTERBANK_LAYOUT
+#define FILTERBANK_LAYOUT       FILTERBANK_MEL  // Bandas (LINEAR/MEL/BARK/LOG)
+#endif
+#ifndef FFT_WINDOW
+#define FFT_WINDOW              FFT_WINDOW_HANN // Janela da FFT (RECTANGULAR/HANN/BLACKMAN)
+#endif
 
 // Configurações de Debug
+#ifndef DEBUG_ENABLED
 #define DEBUG_ENABLED           1       // Ativar debug (0/1)
+#endif
+#ifndef SHOW_FPS
 #define SHOW_FPS                0       // Mostrar FPS na tela (0/1)
+#endif
 
 // Macros de conveniência
 #define CLAMP(x, min, max)      ((x) < (min) ? (min) : ((x) > (max) ? (max) : (x)))
@@ -0,0 +1,138 @@
+#include "decimator.h"
+#include "decimator_data.h"
+#include "config.h"
+#include "platform.h"
+#include <string.h>
+
+#if DECIMATOR_TAPS_PER_PHASE * DECIMATOR_MAX_RATIO != DECIMATOR_MAX_TAPS
+#error "src/decimator_data.c doesn't match DECIMATOR_MAX_TAPS, regenerate it with tools/gen_decimator.py"
+#endif
+
+#define HALFBAND_MASK           (HALFBAND_DELAY_SIZE - 1)
+#define HALFBAND_CENTER         ((HALFBAND_TAPS - 1) / 2)
+
+#if HALFBAND_TAPS != 19
+#error "halfband_process is unrolled for 19 taps"
+#endif
+
+// Q15 coefficients at odd offsets +-1, +-3, ... from the center tap;
+// center + 2 * sum(odd) = 32767
+static const int16_t halfband_center = 16387;
+static const int16_t halfband_odd[5] = {
+    10018, -2397, 709, -151, 11
+};
+
+// Set up a decimator for `ratio` (1, 2 or 4; 1 passes samples through).
+// Returns 0 on success, -1 for an unsupported ratio.
+int decimator_init(decimator_t *dec, int ratio) {
+    switch (ratio) {
+        case 1:
+            dec->coefficients = NULL;
+            dec->taps = 0;
+            break;
+        case 2:
+            dec->coefficients = decimator_fir2;
+            dec->taps = 2 * DECIMATOR_TAPS_PER_PHASE;
+            break;
+        case 4:
+            dec->coefficients = decimator_fir4;
+            dec->taps = 4 * DECIMATOR_TAPS_PER_PHASE;
+            break;
+        default:
+            #if DEBUG_ENABLED
+            debugf("Decimator: unsupported ratio %d\n", ratio);
+            #endif
+            return -1;
+    }
+    
+    dec->ratio = ratio;
+    decimator_reset(dec);
+    return 0;
+}
+
+// Clear the history, e.g. when the input jumps
+void decimator_reset(decimator_t *dec) {
+    memset(dec->delay, 0, sizeof(dec->delay));
+    dec->write = 0;
+    dec->phase = 0;
+}
+
+// Consume `count` input samples, writing one output per `ratio` inputs;
+// returns the number written. Phase carries over between calls.
+int decimator_process(decimator_t *dec, const int16_t *in, int count, int16_t *out) {
+    if (dec->ratio == 1) {
+        memcpy(out, in, count * sizeof(int16_t));
+        return count;
+    }
+    
+    const int16_t *h = dec->coefficients;
+    int taps = dec->taps;
+    int write = dec->write;
+    int phase = dec->phase;
+    int produced = 0;
+    
+    for (int n = 0; n < count; n++) {
+        // Every sample lands twice, so after the increment
+        // delay[write .. write + taps - 1] is the last `taps` inputs, oldest first
+        dec->delay[write] = in[n];
+        dec->delay[write + taps] = in[n];
+        if (++write == taps) write = 0;
+        
+        if (++phase < dec->ratio) continue;
+        phase = 0;
+        
+        // Linear phase: h is symmetric, so no reversal is needed
+        const int16_t *x = &dec->delay[write];
+        int32_t acc = 0;
+        for (int k = 0; k < taps; k++) {
+            acc += h[k] * x[k];
+        }
+        
+        acc = (acc + (1 << 14)) >> 15;
+        out[produced++] = (int16_t)(acc > 32767 ? 32767 : (acc < -32768 ? -32768 : acc));
+    }
+    
+    dec->write = write;
+    dec->phase = phase;
+    return produced;
+}
+
+void halfband_init(halfband_t *stage) {
+    memset(stage->delay, 0, sizeof(stage->delay));
+    stage->write = 0;
+    stage->phase = 0;
+}
+
+// Filter `count` input samples and keep every second output; returns the
+// number of samples written to `out` (count / 2, give or take the phase)
+int halfband_process(halfband_t *stage, const int16_t *in, int count, int16_t *out) {
+    int16_t *delay = stage->delay;
+    uint32_t write = stage->write;
+    int phase = stage->phase;
+    int produced = 0;
+    
+    for (int n = 0; n < count; n++) {
+        delay[write & HALFBAND_MASK] = in[n];
+        write++;
+        
+        phase ^= 1;
+        if (phase) continue;
+        
+        // Newest sample is at write - 1, the center tap HALFBAND_CENTER older;
+        // symmetric taps share one multiply
+        uint32_t c = write - 1 - HALFBAND_CENTER;
+        int32_t acc = halfband_center * delay[c & HALFBAND_MASK];
+        acc += halfband_odd[0] * (delay[(c - 1) & HALFBAND_MASK] + delay[(c + 1) & HALFBAND_MASK]);
+        acc += halfband_odd[1] * (delay[(c - 3) & HALFBAND_MASK] + delay[(c + 3) & HALFBAND_MASK]);
+        acc += halfband_odd[2] * (delay[(c - 5) & HALFBAND_MASK] + delay[(c + 5) & HALFBAND_MASK]);
+        acc += halfband_odd[3] * (delay[(c - 7) & HALFBAND_MASK] + delay[(c + 7) & HALFBAND_MASK]);
+        acc += halfband_odd[4] * (delay[(c - 9) & HALFBAND_MASK] + delay[(c + 9) & HALFBAND_MASK]);
+        
+        acc = (acc + (1 << 14)) >> 15;
+        out[produced++] = (int16_t)(acc > 32767 ? 32767 : (acc < -32768 ? -32768 : acc));
+    }
+    
+    stage->write = write;
+    stage->phase = phase;
+    return produced;
+}
@@ -0,0 +1,51 @@
+#ifndef DECIMATOR_H
+#define DECIMATOR_H
+
+#include <stdint.h>
+
+// =============================================================================
+// Streaming decimation
+//
+// decimator_t: polyphase anti-aliasing FIR for 2x / 4x rate reduction, with
+// Q15 coefficients from tools/gen_decimator.py (src/decimator_data.c). Only
+// the kept outputs are computed, so each costs DECIMATOR_TAPS_PER_PHASE
+// multiply-adds per input sample it consumes (the noble-identity saving).
+//
+// halfband_t: the cheaper fixed 2x stage used by the octave cascade.
+// A 19-tap Q15 half-band FIR: every other coefficient is zero and the
+// response is symmetric, so each output costs 5 multiply-adds plus the
+// center tap. Passband is flat to ~0.15 fs, the stopband (> 0.35 fs) sits
+// around -39 dB. State carries across calls, so a stream can be fed in
+// blocks of any size.
+// =============================================================================
+
+#define DECIMATOR_MAX_RATIO     4
+#define DECIMATOR_MAX_TAPS      48      // DECIMATOR_TAPS_PER_PHASE * DECIMATOR_MAX_RATIO
+
+typedef struct {
+    const int16_t *coefficients;
+    int taps;
+    int ratio;
+    int write;                  // Next delay slot, 0..taps-1
+    int phase;                  // Inputs consumed towards the next output
+    int16_t delay[2 * DECIMATOR_MAX_TAPS];  // Mirrored, so taps are contiguous
+} decimator_t;
+
+#define HALFBAND_TAPS           19
+#define HALFBAND_DELAY_SIZE     32      // Power of two >= HALFBAND_TAPS
+
+typedef struct {
+    int16_t delay[HALFBAND_DELAY_SIZE];
+    uint32_t write;             // Next delay slot
+    int phase;                  // 1 when the next input completes an output
+} halfband_t;
+
+// Function prototypes
+int decimator_init(decimator_t *dec, int ratio);
+void decimator_reset(decimator_t *dec);
+int decimator_process(decimator_t *dec, const int16_t *in, int count, int16_t *out);
+
+void halfband_init(halfband_t *stage);
+int halfband_process(halfband_t *stage, const int16_t *in, int count, int16_t *out);
+
+#endif // DECIMATOR_H
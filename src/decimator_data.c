@@ -0,0 +1,23 @@
+// Decimator coefficients generated by tools/gen_decimator.py
+// Generated automatically - do not edit
+// 12 taps/phase, Kaiser beta 5, cutoff 0.9 x output Nyquist
+
+#include "decimator_data.h"
+
+// 2x: linear phase, Q15, sum 32768
+const int16_t decimator_fir2[24] = {
+       -17,     65,    129,   -155,   -445,    173,   1102,    128,
+     -2344,  -1434,   5702,  13480,  13480,   5702,  -1434,  -2344,
+       128,   1102,    173,   -445,   -155,    129,     65,    -17
+};
+
+// 4x: linear phase, Q15, sum 32768
+const int16_t decimator_fir4[48] = {
+       -13,     -5,     20,     55,     76,     53,    -27,   -141,
+      -226,   -207,    -41,    235,    495,    565,    314,   -246,
+      -915,  -1338,  -1136,    -84,   1754,   3986,   6005,   7205,
+      7205,   6005,   3986,   1754,    -84,  -1136,  -1338,   -915,
+      -246,    314,    565,    495,    235,    -41,   -207,   -226,
+      -141,    -27,     53,     76,     55,     20,     -5,    -13
+};
+
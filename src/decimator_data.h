@@ -0,0 +1,14 @@
+// Decimator coefficients generated by tools/gen_decimator.py
+// Generated automatically - do not edit
+
+#ifndef DECIMATOR_DATA_H
+#define DECIMATOR_DATA_H
+
+#include <stdint.h>
+
+#define DECIMATOR_TAPS_PER_PHASE  12
+
+extern const int16_t decimator_fir2[24];
+extern const int16_t decimator_fir4[48];
+
+#endif // DECIMATOR_DATA_H
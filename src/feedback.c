@@ -0,0 +1,42 @@
+#include "feedback.h"
+#include "config.h"
+#include <string.h>
+
+static surface_t trails[2];
+static int current = 0;
+
+// Allocate both surfaces on first use (2 x 150 KB) and start from black
+void feedback_init(void) {
+    for (int i = 0; i < 2; i++) {
+        if (!trails[i].buffer) {
+            trails[i] = surface_alloc(FMT_RGBA16, SCREEN_WIDTH, SCREEN_HEIGHT);
+        }
+        memset(trails[i].buffer, 0, (size_t)trails[i].stride * trails[i].height);
+    }
+    current = 0;
+}
+
+// Fade the previous frame into the other surface and return it as this
+// frame's target; the CPU may draw into it once this returns
+surface_t *feedback_begin(void) {
+    surface_t *previous = &trails[current];
+    current ^= 1;
+    surface_t *target = &trails[current];
+    
+    rdpq_attach(target, NULL);
+    rdpq_set_mode_standard();
+    rdpq_mode_combiner(RDPQ_COMBINER_TEX_FLAT);
+    rdpq_set_prim_color(RGBA32(FEEDBACK_DECAY, FEEDBACK_DECAY, FEEDBACK_DECAY, 0xFF));
+    rdpq_tex_blit(previous, 0, 0, NULL);
+    rdpq_detach_wait();
+    
+    return target;
+}
+
+// Copy this frame's target to the display; it becomes the next source
+void feedback_present(surface_t *display) {
+    rdpq_attach(display, NULL);
+    rdpq_set_mode_copy(false);
+    rdpq_tex_blit(&trails[current], 0, 0, NULL);
+    rdpq_detach_wait();
+}
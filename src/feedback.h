@@ -0,0 +1,22 @@
+#ifndef FEEDBACK_H
+#define FEEDBACK_H
+
+#include "platform.h"
+
+// =============================================================================
+// Frame feedback (persistence trails)
+//
+// Two offscreen RGBA16 surfaces ping-pong: each frame the RDP blits the
+// previous one, darkened by the prim color through the combiner, into the
+// other, the mode draws on top without clearing, and the result is copied to
+// the display. The display's own buffers can't be the source since one of
+// them is always being scanned out. The whole effect is a handful of rdpq
+// commands per frame.
+// =============================================================================
+
+// Function prototypes
+void feedback_init(void);
+surface_t *feedback_begin(void);
+void feedback_present(surface_t *display);
+
+#endif // FEEDBACK_H
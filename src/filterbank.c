@@ -0,0 +1,147 @@
+#include "filterbank.h"
+#include "filterbank_data.h"
+#include "config.h"
+#include "audio.h"
+#include <math.h>
+#include <string.h>
+
+#if FILTERBANK_FFT_SIZE != FFT_SIZE || FILTERBANK_NUM_BANDS != NUM_FREQUENCY_BINS || FILTERBANK_SAMPLE_RATE != AUDIO_SAMPLE_RATE
+#error "src/filterbank_data.c doesn't match the configuration, regenerate it with tools/gen_filterbank.py"
+#endif
+
+#if FILTERBANK_MULTIRES_SIZE != MULTIRES_FFT_SIZE || FILTERBANK_MULTIRES_OCTAVES != MULTIRES_OCTAVES
+#error "src/filterbank_data.c multires tables don't match the configuration, regenerate them with tools/gen_filterbank.py"
+#endif
+
+// ln(m) for mantissas m in [1, 2), linearly interpolated
+#define LOG_TABLE_BITS          8
+#define LOG_TABLE_SIZE          (1 << LOG_TABLE_BITS)
+
+static float log_table[LOG_TABLE_SIZE + 1];
+static int filterbank_initialized = 0;
+
+// Active layout's weights expanded to float with the Q15 scale folded in
+static float weight_table[FILTERBANK_MAX_WEIGHTS];
+static float multires_weight_table[FILTERBANK_MULTIRES_MAX_WEIGHTS];
+
+static const filterbank_band_t *active_bands = filterbank_mel_bands;
+static const int16_t *active_weights = filterbank_mel_weights;
+static const filterbank_band_t *active_multires_bands = filterbank_multires_mel_bands;
+static filterbank_layout_t active_layout = FILTERBANK_MEL;
+
+void filterbank_init(void) {
+    if (filterbank_initialized) return;
+    
+    for (int i = 0; i <= LOG_TABLE_SIZE; i++) {
+        log_table[i] = logf(1.0f + (float)i / LOG_TABLE_SIZE);
+    }
+    
+    filterbank_initialized = 1;
+    filterbank_set_layout(FILTERBANK_LAYOUT);
+}
+
+static void expand_weights(const filterbank_band_t *bands, const int16_t *weights, float *table) {
+    const filterbank_band_t *last = &bands[NUM_FREQUENCY_BINS - 1];
+    for (int i = 0; i < last->offset + last->length; i++) {
+        table[i] = weights[i] * (1.0f / 32768.0f);
+    }
+}
+
+void filterbank_set_layout(filterbank_layout_t layout) {
+    const int16_t *multires_weights;
+    
+    switch (layout) {
+        case FILTERBANK_LINEAR:
+            active_bands = filterbank_linear_bands;
+            active_weights = filterbank_linear_weights;
+            active_multires_bands = filterbank_multires_linear_bands;
+            multires_weights = filterbank_multires_linear_weights;
+            break;
+        case FILTERBANK_BARK:
+            active_bands = filterbank_bark_bands;
+            active_weights = filterbank_bark_weights;
+            active_multires_bands = filterbank_multires_bark_bands;
+            multires_weights = filterbank_multires_bark_weights;
+            break;
+        case FILTERBANK_LOG:
+            active_bands = filterbank_log_bands;
+            active_weights = filterbank_log_weights;
+            active_multires_bands = filterbank_multires_log_bands;
+            multires_weights = filterbank_multires_log_weights;
+            break;
+        default:
+            layout = FILTERBANK_MEL;
+            active_bands = filterbank_mel_bands;
+            active_weights = filterbank_mel_weights;
+            active_multires_bands = filterbank_multires_mel_bands;
+            multires_weights = filterbank_multires_mel_weights;
+            break;
+    }
+    
+    expand_weights(active_bands, active_weights, weight_table);
+    expand_weights(active_multires_bands, multires_weights, multires_weight_table);
+    
+    active_layout = layout;
+}
+
+filterbank_layout_t filterbank_get_layout(void) {
+    return active_layout;
+}
+
+const filterbank_band_t *filterbank_bands(void) {
+    return active_bands;
+}
+
+const int16_t *filterbank_weights(void) {
+    return active_weights;
+}
+
+float filterbank_log_scale(float x) {
+    float y = 1.0f + x * 10.0f;
+    if (!(y > 1.0f)) return 0.0f;
+    
+    // y = m * 2^e with m in [1, 2): ln(y) = e * ln(2) + ln(m)
+    uint32_t bits;
+    memcpy(&bits, &y, sizeof(bits));
+    int e = (int)((bits >> 23) & 0xFF) - 127;
+    uint32_t mantissa = bits & 0x7FFFFF;
+    
+    uint32_t index = mantissa >> (23 - LOG_TABLE_BITS);
+    float frac = (float)(mantissa & ((1u << (23 - LOG_TABLE_BITS)) - 1)) * (1.0f / (1u << (23 - LOG_TABLE_BITS)));
+    float ln_m = log_table[index] + (log_table[index + 1] - log_table[index]) * frac;
+    
+    return e * 0.69314718f + ln_m;
+}
+
+float filterbank_full_scale(void) {
+    return logf(1.0f + (FFT_SIZE / 2) * 10.0f);
+}
+
+static void apply_bands(const filterbank_band_t *band_table, const float *weights,
+                        const float *magnitudes, float *bands) {
+    for (int b = 0; b < NUM_FREQUENCY_BINS; b++) {
+        const filterbank_band_t *band = &band_table[b];
+        const float *m = &magnitudes[band->start];
+        const float *w = &weights[band->offset];
+        
+        float sum = 0.0f;
+        for (int j = 0; j < band->length; j++) {
+            sum += m[j] * w[j];
+        }
+        
+        bands[b] = filterbank_log_scale(sum);
+    }
+}
+
+void filterbank_apply(const float *magnitudes, float *bands) {
+    if (!filterbank_initialized) filterbank_init();
+    
+    apply_bands(active_bands, weight_table, magnitudes, bands);
+}
+
+void filterbank_apply_multires(const float *octave_magnitudes, float *bands) {
+    if (!filterbank_initialized) filterbank_init();
+    
+    // Band starts index the concatenated octave spectra directly
+    apply_bands(active_multires_bands, multires_weight_table, octave_magnitudes, bands);
+}
@@ -0,0 +1,51 @@
+#ifndef FILTERBANK_H
+#define FILTERBANK_H
+
+#include <stdint.h>
+
+// =============================================================================
+// Sparse filterbank: FFT magnitudes -> visualizer bands
+//
+// Each band is a short run of Q15 weights over consecutive FFT bins, read
+// from tables generated by tools/gen_filterbank.py (src/filterbank_data.c)
+// for the configured FFT_SIZE / NUM_FREQUENCY_BINS / AUDIO_SAMPLE_RATE.
+// Band levels are log-compressed with a table-driven logarithm.
+//
+// A second table set reads the multi-resolution analyzer's output (see
+// multires.h): MULTIRES_OCTAVES spectra of MULTIRES_FFT_SIZE/2 bins laid
+// end to end, each band taken from the octave that resolves it best.
+// =============================================================================
+
+typedef enum {
+    FILTERBANK_LINEAR,
+    FILTERBANK_MEL,
+    FILTERBANK_BARK,
+    FILTERBANK_LOG,
+    FILTERBANK_LAYOUT_COUNT
+} filterbank_layout_t;
+
+typedef struct {
+    uint16_t start;             // First FFT bin
+    uint16_t length;            // Number of bins / weights
+    uint16_t offset;            // Index of the first weight
+} filterbank_band_t;
+
+// Function prototypes
+void filterbank_init(void);
+void filterbank_set_layout(filterbank_layout_t layout);
+filterbank_layout_t filterbank_get_layout(void);
+void filterbank_apply(const float *magnitudes, float *bands);
+void filterbank_apply_multires(const float *octave_magnitudes, float *bands);
+
+// Current layout's tables (for tests and tools)
+const filterbank_band_t *filterbank_bands(void);
+const int16_t *filterbank_weights(void);
+
+// log(1 + 10x), the visual compression curve, from a lookup table
+float filterbank_log_scale(float x);
+
+// Band level of a full-scale sine, whose windowed peak magnitude is
+// FFT_SIZE / 2: dividing by it maps bands to 0..1 (louder mixes may exceed 1)
+float filterbank_full_scale(void);
+
+#endif // FILTERBANK_H
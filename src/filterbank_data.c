@@ -0,0 +1,787 @@
+// Filterbank tables generated by tools/gen_filterbank.py
+// Generated automatically - do not edit
+// FFT size 512, 64 bands, 22050 Hz, fmin 30 Hz
+// Multi-resolution: 6 octaves of 128-point FFTs
+
+#include "filterbank_data.h"
+
+const filterbank_band_t filterbank_linear_bands[64] = {
+    {    0,   4,     0 },
+    {    4,   4,     4 },
+    {    8,   4,     8 },
+    {   12,   4,    12 },
+    {   16,   4,    16 },
+    {   20,   4,    20 },
+    {   24,   4,    24 },
+    {   28,   4,    28 },
+    {   32,   4,    32 },
+    {   36,   4,    36 },
+    {   40,   4,    40 },
+    {   44,   4,    44 },
+    {   48,   4,    48 },
+    {   52,   4,    52 },
+    {   56,   4,    56 },
+    {   60,   4,    60 },
+    {   64,   4,    64 },
+    {   68,   4,    68 },
+    {   72,   4,    72 },
+    {   76,   4,    76 },
+    {   80,   4,    80 },
+    {   84,   4,    84 },
+    {   88,   4,    88 },
+    {   92,   4,    92 },
+    {   96,   4,    96 },
+    {  100,   4,   100 },
+    {  104,   4,   104 },
+    {  108,   4,   108 },
+    {  112,   4,   112 },
+    {  116,   4,   116 },
+    {  120,   4,   120 },
+    {  124,   4,   124 },
+    {  128,   4,   128 },
+    {  132,   4,   132 },
+    {  136,   4,   136 },
+    {  140,   4,   140 },
+    {  144,   4,   144 },
+    {  148,   4,   148 },
+    {  152,   4,   152 },
+    {  156,   4,   156 },
+    {  160,   4,   160 },
+    {  164,   4,   164 },
+    {  168,   4,   168 },
+    {  172,   4,   172 },
+    {  176,   4,   176 },
+    {  180,   4,   180 },
+    {  184,   4,   184 },
+    {  188,   4,   188 },
+    {  192,   4,   192 },
+    {  196,   4,   196 },
+    {  200,   4,   200 },
+    {  204,   4,   204 },
+    {  208,   4,   208 },
+    {  212,   4,   212 },
+    {  216,   4,   216 },
+    {  220,   4,   220 },
+    {  224,   4,   224 },
+    {  228,   4,   228 },
+    {  232,   4,   232 },
+    {  236,   4,   236 },
+    {  240,   4,   240 },
+    {  244,   4,   244 },
+    {  248,   4,   248 },
+    {  252,   4,   252 },
+};
+
+const int16_t filterbank_linear_weights[256] = {
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192
+};
+
+const filterbank_band_t filterbank_mel_bands[64] = {
+    {    1,   2,     0 },
+    {    2,   2,     2 },
+    {    3,   1,     4 },
+    {    4,   1,     5 },
+    {    4,   2,     6 },
+    {    5,   2,     8 },
+    {    6,   2,    10 },
+    {    7,   2,    12 },
+    {    8,   2,    14 },
+    {    9,   2,    16 },
+    {   10,   3,    18 },
+    {   11,   3,    21 },
+    {   13,   2,    24 },
+    {   14,   2,    26 },
+    {   15,   3,    28 },
+    {   16,   3,    31 },
+    {   18,   3,    34 },
+    {   19,   3,    37 },
+    {   21,   3,    40 },
+    {   22,   4,    43 },
+    {   24,   4,    47 },
+    {   26,   4,    51 },
+    {   28,   3,    55 },
+    {   30,   4,    58 },
+    {   31,   5,    62 },
+    {   34,   4,    67 },
+    {   36,   4,    71 },
+    {   38,   5,    75 },
+    {   40,   5,    80 },
+    {   43,   5,    85 },
+    {   45,   6,    90 },
+    {   48,   6,    96 },
+    {   51,   6,   102 },
+    {   54,   6,   108 },
+    {   57,   6,   114 },
+    {   60,   7,   120 },
+    {   63,   7,   127 },
+    {   67,   7,   134 },
+    {   70,   8,   141 },
+    {   74,   8,   149 },
+    {   78,   8,   157 },
+    {   82,   9,   165 },
+    {   86,   9,   174 },
+    {   91,   9,   183 },
+    {   95,  10,   192 },
+    {  100,  10,   202 },
+    {  105,  11,   212 },
+    {  110,  12,   223 },
+    {  116,  12,   235 },
+    {  122,  12,   247 },
+    {  128,  12,   259 },
+    {  134,  13,   271 },
+    {  140,  14,   284 },
+    {  147,  15,   298 },
+    {  154,  16,   313 },
+    {  162,  16,   329 },
+    {  170,  16,   345 },
+    {  178,  17,   361 },
+    {  186,  18,   378 },
+    {  195,  19,   396 },
+    {  204,  20,   415 },
+    {  214,  20,   435 },
+    {  224,  21,   455 },
+    {  234,  22,   476 },
+};
+
+const int16_t filterbank_mel_weights[498] = {
+    19764, 13003, 32005,   762, 32767, 32767,  6207, 26560, 10360, 22407, 12418, 20349,
+    12824, 19943, 11901, 20866,  9888, 22879,  6735, 24927,  1105,  2908, 24136,  5723,
+    20831, 11936, 14755, 18012,  7040, 20714,  5013,  1442, 18502, 12823,  9958, 18414,
+     4395,  3067, 17300, 12400,  8191, 18005,  6571,  1085, 13047, 15049,  3586,  4566,
+    15303, 11593,  1305,  6680, 16400,  9501,   186,  7732, 16587,  8448,  7987, 16069,
+     8260,   451,    32,  7525, 15020,  8685,  1505,  6548, 13495,  9691,  3033,  5107,
+    11570, 11141,  4949,  3147,  8927, 12435,  6898,  1360,  1079,  6460, 11841,  9271,
+     4116,  3682,  8563, 11517,  6841,  2164,   920,  5485, 10049,  9811,  5438,  1064,
+     2227,  6373, 10519,  8522,  4549,   577,  2868,  6659, 10450,  7896,  4263,   631,
+     2979,  6465,  9952,  7797,  4457,  1117,  2661,  5882,  9103,  8127,  5040,  1954,
+     1976,  4945,  7914,  8749,  5906,  3061,   216,   980,  3652,  6324,  8995,  6832,
+     4272,  1712,  2307,  4804,  7300,  8177,  5785,  3393,  1001,   757,  3041,  5325,
+     7609,  7292,  5103,  2914,   726,  1216,  3308,  5399,  7490,  6844,  4840,  2837,
+      833,  1287,  3212,  5137,  7062,  6784,  4940,  3095,  1250,  1034,  2803,  4571,
+     6340,  6993,  5299,  3604,  1909,   214,   520,  2133,  3747,  5361,  6975,  5827,
+     4281,  2735,  1188,  1300,  2789,  4277,  5765,  6580,  5153,  3727,  2301,   875,
+      317,  1685,  3053,  4421,  5789,  6124,  4811,  3500,  2189,   878,   486,  1744,
+     3002,  4259,  5517,  5962,  4757,  3552,  2347,  1141,   378,  1522,  2666,  3810,
+     4955,  5980,  4884,  3788,  2691,  1595,   498,    56,  1118,  2180,  3242,  4304,
+     5368,  5294,  4276,  3259,  2241,  1223,   206,   529,  1498,  2468,  3437,  4407,
+     5376,  4831,  3902,  2973,  2044,  1115,   187,   710,  1600,  2490,  3381,  4271,
+     5162,  4658,  3805,  2952,  2099,  1246,   393,   657,  1478,  2300,  3121,  3943,
+     4763,  4719,  3932,  3144,  2357,  1570,   783,   403,  1151,  1899,  2647,  3395,
+     4143,  4882,  4166,  3449,  2733,  2016,  1300,   583,     4,   695,  1386,  2078,
+     2769,  3461,  4152,  4590,  3928,  3266,  2603,  1941,  1278,   616,   118,   750,
+     1381,  2013,  2645,  3277,  3908,  4453,  3848,  3242,  2637,  2032,  1426,   821,
+      216,    41,   624,  1207,  1790,  2373,  2956,  3538,  4122,  3969,  3411,  2852,
+     2294,  1735,  1177,   618,    60,   343,   876,  1409,  1942,  2475,  3008,  3541,
+     4072,  3675,  3164,  2654,  2143,  1632,  1122,   611,   100,   438,   928,  1418,
+     1908,  2398,  2888,  3378,  3865,  3587,  3117,  2648,  2178,  1708,  1239,   769,
+      300,   362,   812,  1262,  1712,  2162,  2612,  3062,  3513,  3644,  3213,  2781,
+     2350,  1919,  1488,  1056,   625,   194,   149,   563,   976,  1389,  1802,  2215,
+     2629,  3042,  3454,  3422,  3026,  2630,  2235,  1839,  1443,  1047,   651,   255,
+      209,   588,   968,  1347,  1726,  2106,  2485,  2864,  3244,  3359,  2995,  2632,
+     2268,  1905,  1541,  1178,   814,   451,    87,   124,   472,   820,  1168,  1516,
+     1865,  2213,  2561,  2909,  3257,  3087,  2754,  2420,  2087,  1753,  1419,  1086,
+      752,   419,    85,   243,   563,   882,  1202,  1522,  1841,  2161,  2481,  2800,
+     3120,  2974,  2667,  2361,  2055,  1748,  1442,  1136,   829,   523,   217,   219,
+      512,   806,  1099,  1393,  1686,  1980,  2273,  2567,  2860,  2985,  2704,  2423,
+     2142,  1861,  1579,  1298,  1017,   736,   454,   173,    79,   349,   618,   888,
+     1158,  1428,  1698,  1967,  2237,  2507,  2777,  2846,  2585,  2326,  2068,  1809,
+     1551,  1292,  1034,   775,   517,   258
+};
+
+const filterbank_band_t filterbank_bark_bands[64] = {
+    {    1,   1,     0 },
+    {    2,   1,     1 },
+    {    2,   2,     2 },
+    {    3,   1,     4 },
+    {    4,   1,     5 },
+    {    4,   2,     6 },
+    {    5,   2,     8 },
+    {    6,   1,    10 },
+    {    7,   1,    11 },
+    {    7,   2,    12 },
+    {    8,   2,    14 },
+    {    9,   2,    16 },
+    {   10,   2,    18 },
+    {   11,   1,    20 },
+    {   12,   1,    21 },
+    {   12,   2,    22 },
+    {   13,   2,    24 },
+    {   14,   2,    26 },
+    {   15,   2,    28 },
+    {   16,   3,    30 },
+    {   17,   3,    33 },
+    {   19,   2,    36 },
+    {   20,   2,    38 },
+    {   21,   3,    40 },
+    {   22,   3,    43 },
+    {   24,   2,    46 },
+    {   25,   3,    48 },
+    {   26,   3,    51 },
+    {   28,   3,    54 },
+    {   29,   3,    57 },
+    {   31,   3,    60 },
+    {   32,   4,    63 },
+    {   34,   4,    67 },
+    {   36,   4,    71 },
+    {   38,   4,    75 },
+    {   40,   4,    79 },
+    {   42,   4,    83 },
+    {   44,   5,    87 },
+    {   46,   5,    92 },
+    {   49,   5,    97 },
+    {   51,   6,   102 },
+    {   54,   6,   108 },
+    {   57,   6,   114 },
+    {   60,   7,   120 },
+    {   63,   7,   127 },
+    {   67,   7,   134 },
+    {   70,   8,   141 },
+    {   74,   9,   149 },
+    {   78,  10,   158 },
+    {   83,  10,   168 },
+    {   88,  10,   178 },
+    {   93,  11,   188 },
+    {   98,  13,   199 },
+    {  104,  14,   212 },
+    {  111,  15,   226 },
+    {  118,  16,   241 },
+    {  126,  18,   257 },
+    {  134,  21,   275 },
+    {  144,  23,   296 },
+    {  155,  25,   319 },
+    {  167,  28,   344 },
+    {  180,  33,   372 },
+    {  195,  38,   405 },
+    {  213,  43,   443 },
+};
+
+const int16_t filterbank_bark_weights[486] = {
+    32767, 32767,  7409, 25358, 32767, 32767,  6751, 26016, 27712,  5055, 32767, 32767,
+     9413, 23354, 19796, 12971, 27356,  5411, 32617,   150, 32767, 32767,  2984, 29783,
+     4660, 28107,  5103, 27664,  4484, 28283,  2725, 27587,  2455,   579, 25865,  6323,
+    21908, 10859, 16987, 15780, 11528, 20971,   268,  4875, 21937,  5955, 18757, 14010,
+    10251, 18984,  3532,  3492, 18471, 10804, 10614, 17674,  4479,  3321, 16684, 12762,
+     7186, 17997,  7584,    34, 10981, 16110,  5642,  2675, 12520, 13488,  4084,  4107,
+    13015, 12073,  3572,  4583, 12684, 11611,  3889,  4289, 11687, 11917,  4874,  3365,
+    10146, 12852,  6404,  1786,  7585, 13305,  7799,  2292,    39,  5678, 11316, 10541,
+     5193,  2769,  7512, 11988,  7495,  3003,   129,  4554,  8980, 10553,  6368,  2183,
+     1298,  5215,  9132,  9404,  5708,  2010,  1671,  5163,  8655,  9051,  5759,  2468,
+     1410,  4499,  7587,  9176,  6271,  3365,   459,   681,  3403,  6125,  8848,  7126,
+     4570,  2014,  2024,  4429,  6833,  8249,  5997,  3744,  1491,   449,  2568,  4686,
+     6805,  7536,  5555,  3574,  1594,   622,  2460,  4297,  6135,  7279,  5565,  3851,
+     2136,   422,   314,  1923,  3531,  5139,  6748,  6016,  4519,  3022,  1526,    29,
+     1038,  2414,  3790,  5167,  6542,  5318,  4040,  2763,  1486,   209,  1168,  2360,
+     3551,  4743,  5935,  5207,  4105,  3002,  1899,   797,   852,  1871,  2889,  3908,
+     4926,  5402,  4463,  3523,  2584,  1644,   705,   239,  1103,  1967,  2830,  3694,
+     4557,  5008,  4213,  3419,  2625,  1831,  1037,   244,   182,   911,  1639,  2368,
+     3097,  3825,  4554,  4315,  3648,  2980,  2313,  1646,   978,   311,   423,  1033,
+     1644,  2254,  2864,  3474,  4086,  4072,  3515,  2959,  2402,  1845,  1289,   732,
+      175,   271,   777,  1284,  1791,  2298,  2804,  3311,  3818,  3662,  3202,  2742,
+     2282,  1822,  1361,   901,   441,   285,   700,  1116,  1531,  1946,  2362,  2777,
+     3193,  3575,  3200,  2824,  2449,  2073,  1698,  1323,   947,   572,   196,    14,
+      354,   694,  1033,  1373,  1713,  2052,  2392,  2731,  3071,  3102,  2798,  2492,
+     2187,  1882,  1576,  1271,   966,   661,   355,    50,   130,   403,   676,   949,
+     1222,  1496,  1769,  2042,  2315,  2588,  2860,  2701,  2457,  2213,  1970,  1726,
+     1482,  1238,   994,   750,   506,   262,    18,   182,   399,   616,   833,  1050,
+     1267,  1484,  1701,  1918,  2135,  2352,  2564,  2407,  2214,  2022,  1829,  1636,
+     1444,  1251,  1059,   866,   673,   481,   288,    96,   158,   328,   499,   669,
+      840,  1010,  1181,  1351,  1521,  1692,  1862,  2033,  2203,  2212,  2062,  1912,
+     1762,  1612,  1462,  1311,  1161,  1011,   861,   711,   561,   411,   261,   110,
+       66,   198,   329,   461,   592,   724,   855,   987,  1118,  1250,  1382,  1513,
+     1645,  1776,  1908,  1975,  1859,  1744,  1630,  1515,  1400,  1285,  1170,  1055,
+      940,   826,   711,   596,   481,   366,   251,   137,    22,    26,   126,   226,
+      326,   425,   525,   625,   724,   824,   924,  1024,  1123,  1223,  1323,  1423,
+     1522,  1622,  1721,  1671,  1585,  1498,  1412,  1326,  1240,  1153,  1067,   981,
+      895,   809,   722,   636,   550,   464,   378,   291,   205,   119,    33,    60,
+      134,   208,   282,   357,   431,   505,   579,   653,   727,   801,   875,   949,
+     1024,  1098,  1172,  1246,  1320,  1394,  1468,  1457,  1394,  1330,  1267,  1204,
+     1140,  1077,  1014,   950,   887,   824,   760,   697,   633,   570,   507,   443,
+      380,   317,   253,   190,   127,    63
+};
+
+const filterbank_band_t filterbank_log_bands[64] = {
+    {    1,   1,     0 },
+    {    1,   1,     1 },
+    {    1,   1,     2 },
+    {    1,   1,     3 },
+    {    1,   1,     4 },
+    {    1,   1,     5 },
+    {    1,   1,     6 },
+    {    1,   1,     7 },
+    {    2,   1,     8 },
+    {    2,   1,     9 },
+    {    2,   1,    10 },
+    {    2,   1,    11 },
+    {    2,   1,    12 },
+    {    2,   1,    13 },
+    {    3,   1,    14 },
+    {    3,   1,    15 },
+    {    3,   1,    16 },
+    {    4,   1,    17 },
+    {    4,   1,    18 },
+    {    4,   1,    19 },
+    {    5,   1,    20 },
+    {    5,   1,    21 },
+    {    6,   1,    22 },
+    {    6,   1,    23 },
+    {    7,   1,    24 },
+    {    7,   2,    25 },
+    {    8,   1,    27 },
+    {    9,   1,    28 },
+    {    9,   2,    29 },
+    {   10,   2,    31 },
+    {   11,   2,    33 },
+    {   12,   2,    35 },
+    {   13,   3,    37 },
+    {   14,   3,    40 },
+    {   16,   3,    43 },
+    {   17,   4,    46 },
+    {   19,   4,    50 },
+    {   21,   4,    54 },
+    {   23,   4,    58 },
+    {   25,   4,    62 },
+    {   27,   5,    66 },
+    {   29,   6,    71 },
+    {   32,   6,    77 },
+    {   35,   7,    83 },
+    {   38,   8,    90 },
+    {   42,   8,    98 },
+    {   46,   9,   106 },
+    {   50,  10,   115 },
+    {   55,  11,   125 },
+    {   60,  12,   136 },
+    {   66,  13,   148 },
+    {   72,  15,   161 },
+    {   79,  16,   176 },
+    {   87,  17,   192 },
+    {   95,  18,   209 },
+    {  104,  20,   227 },
+    {  113,  23,   247 },
+    {  124,  25,   270 },
+    {  136,  27,   295 },
+    {  149,  29,   322 },
+    {  163,  32,   351 },
+    {  178,  36,   383 },
+    {  195,  39,   419 },
+    {  214,  42,   458 },
+};
+
+const int16_t filterbank_log_weights[500] = {
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 23793,  8974, 32767, 32767,  5890, 26877, 10582, 22185, 11181, 21586,  9204,
+    23563,  4589, 22849,  5329,   474, 19257, 13036, 10106, 17961,  4700,  3052, 15769,
+    12779,  1167,  6555, 16707,  9388,   117,  7544, 15931,  8475,   817,  7006, 14100,
+     9070,  2591,  5457, 11566, 10661,  5083,  2912,  7765, 11795,  7363,  2932,   370,
+     4544,  8718, 10190,  6378,  2567,  1177,  4657,  8136,  9443,  6266,  3088,   923,
+     3749,  6576,  9252,  6670,  4089,  1508,    67,  2483,  4899,  7315,  7809,  5604,
+     3398,  1192,   834,  2841,  4848,  6854,  7096,  5264,  3431,  1599,   761,  2417,
+     4073,  5729,  6983,  5469,  3957,  2445,   933,   178,  1574,  2969,  4365,  5760,
+     6133,  4859,  3584,  2310,  1035,   443,  1598,  2753,  3908,  5063,  5804,  4749,
+     3694,  2640,  1585,   530,   182,  1150,  2118,  3086,  4055,  5023,  5068,  4185,
+     3301,  2417,  1533,   649,   400,  1205,  2009,  2814,  3619,  4423,  4819,  4083,
+     3348,  2614,  1879,  1144,   410,   179,   853,  1526,  2200,  2873,  3546,  4220,
+     4322,  3709,  3094,  2479,  1864,  1249,   634,    19,   247,   805,  1364,  1922,
+     2481,  3039,  3598,  4157,  3679,  3169,  2659,  2149,  1639,  1129,   620,   110,
+      453,   921,  1388,  1856,  2323,  2791,  3258,  3726,  3491,  3064,  2637,  2210,
+     1783,  1357,   930,   503,    76,   306,   696,  1085,  1475,  1864,  2254,  2644,
+     3033,  3423,  3199,  2844,  2488,  2132,  1776,  1421,  1065,   709,   353,   267,
+      591,   915,  1239,  1563,  1888,  2212,  2536,  2860,  3176,  2884,  2588,  2292,
+     1996,  1700,  1404,  1108,   812,   516,   220,     2,   273,   544,   815,  1085,
+     1356,  1627,  1898,  2169,  2440,  2711,  2847,  2600,  2353,  2106,  1858,  1611,
+     1364,  1116,   869,   622,   374,   127,    58,   284,   510,   736,   961,  1187,
+     1413,  1639,  1865,  2090,  2316,  2542,  2558,  2351,  2145,  1939,  1733,  1527,
+     1320,  1114,   908,   702,   496,   290,    83,    92,   280,   468,   656,   844,
+     1033,  1221,  1409,  1597,  1786,  1974,  2162,  2350,  2324,  2152,  1980,  1808,
+     1636,  1465,  1293,  1121,   949,   777,   605,   433,   262,    90,    94,   251,
+      408,   565,   722,   879,  1036,  1193,  1350,  1507,  1664,  1821,  1978,  2135,
+     2144,  2005,  1861,  1718,  1575,  1431,  1288,  1145,  1001,   858,   714,   571,
+      428,   284,   141,    62,   193,   324,   455,   586,   716,   847,   978,  1109,
+     1240,  1370,  1501,  1632,  1763,  1893,  2020,  1901,  1781,  1662,  1542,  1423,
+     1303,  1184,  1065,   945,   826,   706,   587,   467,   348,   229,   109,     2,
+      111,   220,   329,   438,   547,   656,   766,   875,   984,  1093,  1202,  1311,
+     1420,  1529,  1638,  1747,  1840,  1739,  1639,  1540,  1440,  1340,  1241,  1141,
+     1042,   942,   842,   743,   643,   544,   444,   344,   245,   145,    45,     8,
+       99,   190,   281,   372,   463,   554,   645,   736,   827,   918,  1009,  1100,
+     1191,  1282,  1373,  1464,  1555,  1644,  1642,  1559,  1476,  1393,  1310,  1227,
+     1144,  1061,   977,   894,   811,   728,   645,   562,   479,   396,   313,   230,
+      146,    63,    41,   117,   193,   269,   345,   421,   496,   572,   648,   724,
+      800,   876,   952,  1028,  1103,  1179,  1255,  1331,  1407,  1483,  1524,  1455,
+     1386,  1316,  1247,  1178,  1108,  1039,   970,   901,   831,   762,   693,   623,
+      554,   485,   416,   346,   277,   208,   139,    69
+};
+
+const filterbank_band_t filterbank_multires_linear_bands[64] = {
+    {  128,   4,     0 },
+    {  132,   4,     4 },
+    {  136,   4,     8 },
+    {  140,   4,    12 },
+    {  144,   4,    16 },
+    {  148,   4,    20 },
+    {  152,   4,    24 },
+    {  156,   4,    28 },
+    {  160,   4,    32 },
+    {   82,   2,    36 },
+    {   84,   2,    38 },
+    {   86,   2,    40 },
+    {   88,   2,    42 },
+    {   90,   2,    44 },
+    {   92,   2,    46 },
+    {   94,   2,    48 },
+    {   96,   2,    50 },
+    {   98,   2,    52 },
+    {  100,   2,    54 },
+    {   19,   1,    56 },
+    {   20,   1,    57 },
+    {   21,   1,    58 },
+    {   22,   1,    59 },
+    {   23,   1,    60 },
+    {   24,   1,    61 },
+    {   25,   1,    62 },
+    {   26,   1,    63 },
+    {   27,   1,    64 },
+    {   28,   1,    65 },
+    {   29,   1,    66 },
+    {   30,   1,    67 },
+    {   31,   1,    68 },
+    {   32,   1,    69 },
+    {   33,   1,    70 },
+    {   34,   1,    71 },
+    {   35,   1,    72 },
+    {   36,   1,    73 },
+    {   37,   1,    74 },
+    {   38,   1,    75 },
+    {   39,   1,    76 },
+    {   40,   1,    77 },
+    {   41,   1,    78 },
+    {   42,   1,    79 },
+    {   43,   1,    80 },
+    {   44,   1,    81 },
+    {   45,   1,    82 },
+    {   46,   1,    83 },
+    {   47,   1,    84 },
+    {   48,   1,    85 },
+    {   49,   1,    86 },
+    {   50,   1,    87 },
+    {   51,   1,    88 },
+    {   52,   1,    89 },
+    {   53,   1,    90 },
+    {   54,   1,    91 },
+    {   55,   1,    92 },
+    {   56,   1,    93 },
+    {   57,   1,    94 },
+    {   58,   1,    95 },
+    {   59,   1,    96 },
+    {   60,   1,    97 },
+    {   61,   1,    98 },
+    {   62,   1,    99 },
+    {   63,   1,   100 },
+};
+
+const int16_t filterbank_multires_linear_weights[101] = {
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+     8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,  8191,  8192,  8192,  8192,
+    16383, 16384, 16383, 16384, 16383, 16384, 16383, 16384, 16383, 16384, 16383, 16384,
+    16383, 16384, 16383, 16384, 16383, 16384, 16383, 16384, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767
+};
+
+const filterbank_band_t filterbank_multires_mel_bands[64] = {
+    {  194,   3,     0 },
+    {  195,   4,     3 },
+    {  197,   3,     7 },
+    {  199,   3,    10 },
+    {  200,   4,    13 },
+    {  202,   4,    17 },
+    {  204,   4,    21 },
+    {  206,   4,    25 },
+    {  208,   4,    29 },
+    {  210,   4,    33 },
+    {  212,   5,    37 },
+    {  214,   5,    42 },
+    {  217,   5,    47 },
+    {  219,   5,    52 },
+    {  222,   5,    57 },
+    {  224,   6,    62 },
+    {  146,   3,    68 },
+    {  147,   3,    71 },
+    {  149,   3,    74 },
+    {  150,   4,    77 },
+    {  152,   4,    81 },
+    {  154,   4,    85 },
+    {  156,   3,    89 },
+    {  158,   4,    92 },
+    {  159,   5,    96 },
+    {  162,   4,   101 },
+    {   82,   2,   105 },
+    {   83,   3,   107 },
+    {   84,   3,   110 },
+    {   86,   2,   113 },
+    {   87,   3,   115 },
+    {   88,   3,   118 },
+    {   90,   3,   121 },
+    {   91,   3,   124 },
+    {   93,   3,   127 },
+    {   94,   4,   130 },
+    {   96,   3,   134 },
+    {   98,   3,   137 },
+    {   18,   2,   140 },
+    {   19,   2,   142 },
+    {   20,   2,   144 },
+    {   21,   2,   146 },
+    {   22,   2,   148 },
+    {   23,   2,   150 },
+    {   24,   3,   152 },
+    {   25,   3,   155 },
+    {   27,   2,   158 },
+    {   28,   3,   160 },
+    {   29,   3,   163 },
+    {   31,   3,   166 },
+    {   32,   3,   169 },
+    {   34,   3,   172 },
+    {   35,   4,   175 },
+    {   37,   4,   179 },
+    {   39,   4,   183 },
+    {   41,   4,   187 },
+    {   43,   4,   191 },
+    {   45,   4,   195 },
+    {   47,   4,   199 },
+    {   49,   5,   203 },
+    {   51,   5,   208 },
+    {   54,   5,   213 },
+    {   56,   6,   218 },
+    {   59,   5,   224 },
+};
+
+const int16_t filterbank_multires_mel_weights[229] = {
+     8413, 18819,  5535,  1841, 16298, 14240,   388,  6715, 18225,  7827, 11290, 16304,
+     5173,  3061, 13608, 13102,  2996,  5117, 14677, 11067,  1906,  6140, 14867, 10061,
+     1699,  6347, 14361,  9869,  2190,  5894, 13291, 10335,  3247,  4901, 11757, 11339,
+     4770,  3398,  9669, 12576,  6567,   557,  1533,  7125, 12718,  8375,  3016,  4879,
+    10256, 11030,  5877,   725,  2088,  6863, 11637,  8377,  3802,  3790,  8201, 11152,
+     6925,  2699,   691,  4778,  8865, 10061,  6144,  2228,  9958, 18414,  4395,  3067,
+    17300, 12400,  8191, 18005,  6571,  1085, 13047, 15049,  3586,  4566, 15303, 11593,
+     1305,  6680, 16400,  9501,   186,  7732, 16587,  8448,  7987, 16069,  8260,   451,
+       32,  7525, 15020,  8685,  1505,  6548, 13495,  9691,  3033, 10299, 22468,  6086,
+    24051,  2630,  2076, 22774,  7917, 18215, 14552, 10985, 19651,  2131,  4220, 19928,
+     8619, 14368, 17037,  1362,  5615, 18752,  8400, 12074, 16682,  4011,  4044, 16196,
+    12086,   441,  7072, 17422,  8273,  9613, 16364,  6790, 21177, 11590, 21481, 11286,
+    20447, 12320, 18323, 14444, 15294, 17473, 11506, 21261,  6356, 23097,  3314,  1907,
+    21651,  9209, 16433, 16334,  8214, 19944,  4609,  2191, 18257, 12319,  9721, 18182,
+     4864,  2778, 16683, 13306,  7072, 18186,  7509,    15, 11372, 16131,  5249,  3037,
+    13272, 13133,  3325,  4813, 14112, 11376,  2466,  5620, 14125, 10585,  2437,  5656,
+    13477, 10564,  3070,  5066, 12295, 11166,  4240,  3960, 10668, 12284,  5855,  2293,
+     8206, 13088,  7423,  1757,   504,  6168, 11834,  9844,  4417,  3488,  8543, 11756,
+     6912,  2068,   887,  5653, 10419,  9836,  5269,   703,  2473,  6788, 11103,  8269,
+     4134
+};
+
+const filterbank_band_t filterbank_multires_bark_bands[64] = {
+    {  259,   5,     0 },
+    {  262,   5,     5 },
+    {  264,   5,    10 },
+    {  267,   5,    15 },
+    {  269,   6,    20 },
+    {  272,   6,    26 },
+    {  275,   6,    32 },
+    {  203,   3,    38 },
+    {  205,   3,    41 },
+    {  206,   3,    44 },
+    {  208,   3,    47 },
+    {  209,   4,    50 },
+    {  211,   4,    54 },
+    {  213,   3,    58 },
+    {  215,   3,    61 },
+    {  216,   4,    64 },
+    {  218,   4,    68 },
+    {  220,   4,    72 },
+    {  222,   4,    76 },
+    {  224,   5,    80 },
+    {  145,   3,    85 },
+    {  147,   2,    88 },
+    {  148,   2,    90 },
+    {  149,   3,    92 },
+    {  150,   3,    95 },
+    {  152,   2,    98 },
+    {  153,   3,   100 },
+    {  154,   3,   103 },
+    {  156,   3,   106 },
+    {  157,   3,   109 },
+    {  159,   3,   112 },
+    {  160,   4,   115 },
+    {  162,   4,   119 },
+    {   82,   2,   123 },
+    {   83,   2,   125 },
+    {   84,   2,   127 },
+    {   85,   2,   129 },
+    {   86,   3,   131 },
+    {   87,   3,   134 },
+    {   89,   2,   137 },
+    {   90,   3,   139 },
+    {   91,   3,   142 },
+    {   93,   3,   145 },
+    {   94,   4,   148 },
+    {   96,   3,   152 },
+    {   98,   3,   155 },
+    {   18,   2,   158 },
+    {   19,   2,   160 },
+    {   20,   2,   162 },
+    {   21,   3,   164 },
+    {   22,   3,   167 },
+    {   24,   2,   170 },
+    {   25,   3,   172 },
+    {   26,   4,   175 },
+    {   28,   4,   179 },
+    {   30,   4,   183 },
+    {   32,   4,   187 },
+    {   34,   5,   191 },
+    {   36,   6,   196 },
+    {   39,   6,   202 },
+    {   42,   7,   208 },
+    {   45,   9,   215 },
+    {   49,  10,   224 },
+    {   54,  10,   234 },
+};
+
+const int16_t filterbank_multires_bark_weights[244] = {
+     1159,  6586, 12013,  9147,  3862,  3991,  9147, 11563,  6543,  1523,  1332,  6278,
+    11225,  9373,  4559,  3148,  7668, 11714,  7317,  2920,   235,  4655,  9075, 10567,
+     6267,  1968,  1395,  5547,  9697,  9412,  5376,  1340,  2118,  6026,  9934,  8694,
+     4896,  1099,  4726, 18873,  9168, 12276, 17213,  3278,  4377, 17529, 10861,  9156,
+    17612,  5999,  1794, 13831, 14406,  2736,  5370, 16479, 10842,    76,  7506, 17311,
+     7950,  9657, 16262,  6848,  1479, 10553, 14758,  5977,  2310, 10782, 13934,  5741,
+     2531, 10458, 13720,  6058,  2224,  9658, 14033,  6852,  1405,  8119, 14229,  7748,
+     1266,   579, 25865,  6323, 21908, 10859, 16987, 15780, 11528, 20971,   268,  4875,
+    21937,  5955, 18757, 14010, 10251, 18984,  3532,  3492, 18471, 10804, 10614, 17674,
+     4479,  3321, 16684, 12762,  7186, 17997,  7584,    34, 10981, 16110,  5642,  2675,
+    12520, 13488,  4084,  8318, 24449,  9274, 23493,  8672, 24095,  6800, 25967,  3367,
+    25081,  4319,    77, 22408, 10282, 16402, 16365,  8631, 19999,  4137,  2635, 18543,
+    11589, 10142, 17777,  4848,  2938, 15807, 13065,   957,  6630, 17235,  8902,  8837,
+    16460,  7470, 18588, 14179, 17282, 15485, 14373, 18394,  9961, 21944,   862,  4252,
+    21601,  6914, 17231, 15536,  7319, 18633,  6815,   755, 12836, 15120,  4056,  4130,
+    13886, 11825,  2926,  5107, 13170, 10906,  3584,  4546, 11320, 11511,  5390,  2708,
+     8014, 12118,  7348,  2579,   527,  4938,  9349,  9924,  5985,  2044,  1606,  5105,
+     8603,  8922,  5818,  2713,  1300,  3999,  6699,  8758,  6381,  4004,  1626,   267,
+     2389,  4511,  6633,  7499,  5646,  3793,  1941,    88,   502,  2090,  3678,  5266,
+     6853,  5621,  4248,  2876,  1503,   130,  1132,  2319,  3507,  4695,  5884,  5077,
+     4061,  3046,  2031,  1015
+};
+
+const filterbank_band_t filterbank_multires_log_bands[64] = {
+    {  326,   1,     0 },
+    {  327,   1,     1 },
+    {  327,   2,     2 },
+    {  328,   1,     4 },
+    {  329,   1,     5 },
+    {  329,   2,     6 },
+    {  330,   2,     8 },
+    {  331,   2,    10 },
+    {  332,   2,    12 },
+    {  333,   3,    14 },
+    {  334,   3,    17 },
+    {  336,   3,    20 },
+    {  337,   3,    23 },
+    {  339,   3,    26 },
+    {  340,   4,    29 },
+    {  342,   5,    33 },
+    {  344,   5,    38 },
+    {  347,   5,    43 },
+    {  349,   6,    48 },
+    {  272,   3,    54 },
+    {  274,   3,    57 },
+    {  275,   4,    60 },
+    {  277,   4,    64 },
+    {  279,   5,    68 },
+    {  281,   5,    73 },
+    {  284,   5,    78 },
+    {  286,   6,    83 },
+    {  209,   3,    89 },
+    {  210,   4,    92 },
+    {  212,   4,    96 },
+    {  214,   4,   100 },
+    {  216,   4,   104 },
+    {  218,   5,   108 },
+    {  220,   6,   113 },
+    {  144,   3,   119 },
+    {  145,   4,   122 },
+    {  147,   4,   126 },
+    {  149,   4,   130 },
+    {  151,   4,   134 },
+    {  153,   4,   138 },
+    {  155,   5,   142 },
+    {  157,   6,   147 },
+    {   80,   3,   153 },
+    {   82,   3,   156 },
+    {   83,   4,   159 },
+    {   85,   4,   163 },
+    {   87,   5,   167 },
+    {   89,   5,   172 },
+    {   92,   5,   177 },
+    {   94,   6,   182 },
+    {   17,   3,   188 },
+    {   18,   4,   191 },
+    {   20,   4,   195 },
+    {   22,   4,   199 },
+    {   24,   5,   203 },
+    {   26,   5,   208 },
+    {   29,   5,   213 },
+    {   31,   7,   218 },
+    {   34,   7,   225 },
+    {   38,   7,   232 },
+    {   41,   8,   239 },
+    {   45,   9,   247 },
+    {   49,  10,   256 },
+    {   54,  10,   266 },
+};
+
+const int16_t filterbank_multires_log_weights[276] = {
+    32767, 32767, 31358,  1409, 32767, 32767, 10333, 22434, 14570, 18197, 14827, 17940,
+    12585, 20182,  7923, 22091,  2753,  3018, 20464,  9285, 13618, 16824,  2325,  5168,
+    17555, 10044,  8660, 16762,  7345,   994,  9868, 15004,  6901,  1599,  8864, 14068,
+     7435,   801,   889,  6886, 12883,  8793,  3316,  4506,  9631, 10890,  6210,  1530,
+     1664,  5885, 10107,  8891,  5037,  1183,  4614, 18323,  9830,  9889, 16773,  6105,
+     2126, 12027, 13828,  4786,  3506, 11705, 12521,  5035,  3257, 10178, 12764,  6444,
+      124,  1796,  7282, 12768,  7965,  2956,  4717,  9530, 10568,  6173,  1779,  1617,
+     5563,  9509,  8962,  5359,  1757, 10457, 17141,  5169,  2858, 14013, 13041,  2855,
+     5163, 14251, 10825,  2528,  5478, 13089, 10575,  3625,  4523, 11027, 11578,  5639,
+     2464,  7614, 12265,  7563,  2861,   226,  4705,  9184, 10308,  6217,  2127, 10106,
+    17961,  4700,  3052, 15769, 12779,  1167,  6555, 16707,  9388,   117,  7544, 15931,
+     8475,   817,  7006, 14100,  9070,  2591,  5457, 11566, 10661,  5083,  2912,  7765,
+    11795,  7363,  2932,   370,  4544,  8718, 10190,  6378,  2567,  2476, 17113, 13178,
+     7188, 17738,  7841,   137,  9925, 15821,  6884,  1686,  9800, 14345,  6936,  1493,
+     7989, 13695,  7761,  1829,   363,  6052, 11741,  9903,  4708,  3156,  7719, 11465,
+     7297,  3130,   366,  4269,  8172, 10218,  6653,  3089,  7563, 18132,  7072,   734,
+    11753, 15171,  5109,  3241, 12229, 12752,  4545,  3710, 11245, 12346,  5466,  2753,
+     8922, 12663,  7031,  1398,  1080,  6333, 11584,  9283,  4487,  3221,  7504, 11259,
+     7347,  3436,   234,  3858,  7482, 10261,  6953,  3644,   335,   364,  3356,  6347,
+     9338,  7186,  4454,  1722,  2268,  4791,  7315,  8055,  5750,  3446,  1142,   775,
+     2873,  4971,  7069,  7144,  5227,  3312,  1396,   878,  2620,  4362,  6104,  6943,
+     5351,  3760,  2170,   579,   395,  1852,  3308,  4764,  6221,  5905,  4575,  3245,
+     1916,   586,   775,  1994,  3214,  4433,  5652,  5566,  4453,  3340,  2227,  1113
+};
+
@@ -0,0 +1,36 @@
+// Filterbank tables generated by tools/gen_filterbank.py
+// Generated automatically - do not edit
+
+#ifndef FILTERBANK_DATA_H
+#define FILTERBANK_DATA_H
+
+#include "filterbank.h"
+
+#define FILTERBANK_FFT_SIZE     512
+#define FILTERBANK_NUM_BANDS    64
+#define FILTERBANK_SAMPLE_RATE  22050
+#define FILTERBANK_MAX_WEIGHTS  500
+
+// Multi-resolution tables index 6 concatenated spectra of 64 bins
+#define FILTERBANK_MULTIRES_SIZE        128
+#define FILTERBANK_MULTIRES_OCTAVES     6
+#define FILTERBANK_MULTIRES_MAX_WEIGHTS 276
+
+extern const filterbank_band_t filterbank_linear_bands[64];
+extern const int16_t filterbank_linear_weights[256];
+extern const filterbank_band_t filterbank_mel_bands[64];
+extern const int16_t filterbank_mel_weights[498];
+extern const filterbank_band_t filterbank_bark_bands[64];
+extern const int16_t filterbank_bark_weights[486];
+extern const filterbank_band_t filterbank_log_bands[64];
+extern const int16_t filterbank_log_weights[500];
+extern const filterbank_band_t filterbank_multires_linear_bands[64];
+extern const int16_t filterbank_multires_linear_weights[101];
+extern const filterbank_band_t filterbank_multires_mel_bands[64];
+extern const int16_t filterbank_multires_mel_weights[229];
+extern const filterbank_band_t filterbank_multires_bark_bands[64];
+extern const int16_t filterbank_multires_bark_weights[244];
+extern const filterbank_band_t filterbank_multires_log_bands[64];
+extern const int16_t filterbank_multires_log_weights[276];
+
+#endif // FILTERBANK_DATA_H
@@ -0,0 +1,58 @@
+#include "governor.h"
+#include "config.h"
+#include "platform.h"
+
+void governor_init(governor_t *governor) {
+    governor->average_us = 0.0f;
+    governor->level = QUALITY_FULL;
+    governor->over = 0;
+    governor->under = 0;
+}
+
+const char *governor_level_name(quality_level_t level) {
+    static const char *names[QUALITY_LEVEL_COUNT] = {
+        "full",
+        "no bloom",
+        "no glow",
+        "no flow lines",
+        "half bars",
+        "no trails",
+        "low res",
+    };
+    return names[level];
+}
+
+// Step one level at a time; counters restart so the new level is judged on
+// its own frames
+static void governor_step(governor_t *governor, int step) {
+    governor->level = (quality_level_t)(governor->level + step);
+    governor->over = 0;
+    governor->under = 0;
+    
+    #if DEBUG_ENABLED
+    debugf("Quality %s: %s (frame %d us, budget %d us)\n", step > 0 ? "down" : "up",
+           governor_level_name(governor->level), (int)governor->average_us, GOVERNOR_BUDGET_US);
+    #endif
+}
+
+// Account one frame's work time and return the quality to draw the next with
+quality_level_t governor_update(governor_t *governor, uint32_t frame_us) {
+    governor->average_us += (frame_us - governor->average_us) * GOVERNOR_SMOOTHING;
+    
+    if (governor->average_us * 100 > GOVERNOR_BUDGET_US * GOVERNOR_SHED_PERCENT) {
+        governor->under = 0;
+        if (++governor->over >= GOVERNOR_SHED_FRAMES && governor->level + 1 < QUALITY_LEVEL_COUNT) {
+            governor_step(governor, 1);
+        }
+    } else if (governor->average_us * 100 < GOVERNOR_BUDGET_US * GOVERNOR_RAISE_PERCENT) {
+        governor->over = 0;
+        if (++governor->under >= GOVERNOR_RAISE_FRAMES && governor->level > QUALITY_FULL) {
+            governor_step(governor, -1);
+        }
+    } else {
+        governor->over = 0;
+        governor->under = 0;
+    }
+    
+    return governor->level;
+}
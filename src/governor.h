@@ -0,0 +1,37 @@
+#ifndef GOVERNOR_H
+#define GOVERNOR_H
+
+#include <stdint.h>
+#include "mode.h"
+
+// =============================================================================
+// Quality governor
+//
+// Fed the measured work time of every frame (analysis plus render, not the
+// wait for vblank). A smoothed average above GOVERNOR_SHED_PERCENT of the
+// budget for GOVERNOR_SHED_FRAMES frames sheds the next effect; one below
+// GOVERNOR_RAISE_PERCENT for GOVERNOR_RAISE_FRAMES brings the last one back.
+// The gap between the two thresholds and the much longer wait to raise keep
+// it from oscillating around the budget. Each frame costs a multiply-add and
+// two compares.
+// =============================================================================
+
+#define GOVERNOR_SHED_PERCENT   90
+#define GOVERNOR_RAISE_PERCENT  60
+#define GOVERNOR_SHED_FRAMES    8       // ~130 ms over budget
+#define GOVERNOR_RAISE_FRAMES   180     // ~3 s of headroom
+#define GOVERNOR_SMOOTHING      0.125f  // Weight of the newest frame in the average
+
+typedef struct {
+    float average_us;           // Smoothed frame work time
+    quality_level_t level;
+    int over;                   // Consecutive frames above the shed threshold
+    int under;                  // ... and below the raise threshold
+} governor_t;
+
+// Function prototypes
+void governor_init(governor_t *governor);
+quality_level_t governor_update(governor_t *governor, uint32_t frame_us);
+const char *governor_level_name(quality_level_t level);
+
+#endif // GOVERNOR_H
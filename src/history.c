@@ -0,0 +1,36 @@
+#include "history.h"
+#include <string.h>
+
+#define HISTORY_MASK            (HISTORY_FRAMES - 1)
+
+#if HISTORY_FRAMES & HISTORY_MASK
+#error "HISTORY_FRAMES must be a power of two"
+#endif
+
+void history_init(band_history_t *history) {
+    memset(history, 0, sizeof(*history));
+}
+
+// Quantize and store one frame of band levels, overwriting the oldest
+void history_push(band_history_t *history, const float *bands) {
+    uint8_t *frame = history->frames[history->count & HISTORY_MASK];
+    const float scale = 255.0f / HISTORY_LEVEL_MAX;
+    
+    for (int b = 0; b < NUM_FREQUENCY_BINS; b++) {
+        float v = bands[b] * scale + 0.5f;
+        frame[b] = v <= 0.0f ? 0 : (v >= 255.0f ? 255 : (uint8_t)v);
+    }
+    
+    history->count++;
+}
+
+// Frame `age` frames back (0 = newest). Ages past the stored history wrap
+// onto zeroed or stale rows rather than failing; check history_length.
+const uint8_t *history_frame(const band_history_t *history, int age) {
+    return history->frames[(history->count - 1 - (uint32_t)age) & HISTORY_MASK];
+}
+
+// Frames currently held (at most HISTORY_FRAMES)
+int history_length(const band_history_t *history) {
+    return history->count < HISTORY_FRAMES ? (int)history->count : HISTORY_FRAMES;
+}
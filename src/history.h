@@ -0,0 +1,36 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <stdint.h>
+#include "audio.h"
+
+// =============================================================================
+// Spectrogram history
+//
+// The last HISTORY_FRAMES band vectors, quantized to uint8 and stored one
+// contiguous NUM_FREQUENCY_BINS row per frame in a power-of-two ring: push
+// and random access are O(1), and walking a frame is a sequential read.
+// 128 frames x 64 bands = 8 KB, about 6 s at one frame per BUFFER_SIZE
+// samples.
+// =============================================================================
+
+#define HISTORY_FRAMES          128     // Power of two
+#define HISTORY_LEVEL_MAX       8.0f    // Band level stored as 255
+
+typedef struct {
+    uint8_t frames[HISTORY_FRAMES][NUM_FREQUENCY_BINS];
+    uint32_t count;             // Frames pushed so far; newest is (count - 1) & mask
+} band_history_t;
+
+// Function prototypes
+void history_init(band_history_t *history);
+void history_push(band_history_t *history, const float *bands);
+const uint8_t *history_frame(const band_history_t *history, int age);
+int history_length(const band_history_t *history);
+
+// Stored value back to a band level
+static inline float history_level(uint8_t value) {
+    return value * (HISTORY_LEVEL_MAX / 255.0f);
+}
+
+#endif // HISTORY_H
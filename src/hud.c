@@ -0,0 +1,157 @@
+#include "hud.h"
+#include "config.h"
+#include <string.h>
+
+// One line of text: a texture wide enough for HUD_MAX_CHARS, of which the
+// first `chars` hold the current string
+typedef struct {
+    surface_t texture;
+    int x, y;
+    int chars;
+    int32_t values[3];          // What the texture currently shows
+} hud_line_t;
+
+enum {
+    HUD_TITLE,
+    HUD_TRACK,
+    HUD_POSITION,
+    HUD_LEVELS,
+    HUD_LINES
+};
+
+static hud_line_t lines[HUD_LINES];
+
+// Rasterize `text` into a line's texture, cut to HUD_MAX_CHARS, over a
+// transparent clear so a shorter string leaves no stale glyphs; the CPU
+// touches 64 pixels per char
+static void line_set(hud_line_t *line, const char *text, uint32_t color) {
+    char clipped[HUD_MAX_CHARS + 1];
+    int chars = 0;
+    while (text[chars] && chars < HUD_MAX_CHARS) {
+        clipped[chars] = text[chars];
+        chars++;
+    }
+    clipped[chars] = '\0';
+    
+    // Alpha-0 background: only glyph pixels are written
+    memset(line->texture.buffer, 0, (size_t)line->texture.stride * line->texture.height);
+    graphics_set_color(color, 0);
+    graphics_draw_text(&line->texture, 0, 0, clipped);
+    line->chars = chars;
+}
+
+static void line_init(hud_line_t *line, int x, int y) {
+    if (!line->texture.buffer) {
+        line->texture = surface_alloc(FMT_RGBA16, HUD_MAX_CHARS * HUD_CHAR_WIDTH, HUD_CHAR_HEIGHT);
+    }
+    line->x = x;
+    line->y = y;
+    line->chars = 0;
+    for (int i = 0; i < 3; i++) line->values[i] = -1;
+}
+
+// Decimal digits of `value` at `out`; returns the end of the string
+static char *format_uint(char *out, uint32_t value) {
+    char digits[10];
+    int count = 0;
+    
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+    
+    while (count) *out++ = digits[--count];
+    *out = '\0';
+    return out;
+}
+
+// Hundredths as "units.hh"
+static char *format_centi(char *out, int32_t centi) {
+    if (centi < 0) {
+        *out++ = '-';
+        centi = -centi;
+    }
+    out = format_uint(out, (uint32_t)centi / 100);
+    *out++ = '.';
+    *out++ = (char)('0' + centi / 10 % 10);
+    *out++ = (char)('0' + centi % 10);
+    *out = '\0';
+    return out;
+}
+
+static char *append(char *out, const char *text) {
+    while (*text) *out++ = *text++;
+    *out = '\0';
+    return out;
+}
+
+// Nearest hundredth, as an integer
+static int32_t to_centi(float value) {
+    return (int32_t)(value * 100.0f + (value < 0.0f ? -0.5f : 0.5f));
+}
+
+// Allocate the line textures and rasterize the static text, once
+void hud_init(void) {
+    #if TITLE_ENABLED
+    line_init(&lines[HUD_TITLE], 10, 10);
+    line_set(&lines[HUD_TITLE], "N64 MUSIC VISUALIZER", COLOR_PINK);
+    line_init(&lines[HUD_TRACK], 10, 25);
+    line_set(&lines[HUD_TRACK], "Intensidade Intro", COLOR_TEAL);
+    #endif
+    
+    // Counter lines exist even without SHOW_FPS (6 KB) so hud_set_stats is
+    // always safe to call; they stay empty until it is
+    line_init(&lines[HUD_LEVELS], 10, SCREEN_HEIGHT - 45);
+    line_init(&lines[HUD_POSITION], 10, SCREEN_HEIGHT - 30);
+}
+
+// Counter lines; each is re-rasterized only when a value it shows changed
+void hud_set_stats(uint32_t frame, int position, int length, float peak, float avg, float bpm) {
+    char text[64];
+    char *p;
+    
+    hud_line_t *line = &lines[HUD_POSITION];
+    if (line->values[0] != (int32_t)frame || line->values[1] != position || line->values[2] != length) {
+        p = append(text, "Frame: ");
+        p = format_uint(p, frame);
+        p = append(p, " | Pos: ");
+        p = format_uint(p, (uint32_t)position);
+        p = append(p, "/");
+        format_uint(p, (uint32_t)length);
+        line_set(line, text, COLOR_WHITE);
+        line->values[0] = (int32_t)frame;
+        line->values[1] = position;
+        line->values[2] = length;
+    }
+    
+    int32_t levels[3] = { to_centi(peak), to_centi(avg), (int32_t)(bpm + 0.5f) };
+    line = &lines[HUD_LEVELS];
+    if (line->values[0] != levels[0] || line->values[1] != levels[1] || line->values[2] != levels[2]) {
+        p = append(text, "Peak: ");
+        p = format_centi(p, levels[0]);
+        p = append(p, " | Avg: ");
+        p = format_centi(p, levels[1]);
+        p = append(p, " | BPM: ");
+        format_uint(p, (uint32_t)levels[2]);
+        line_set(line, text, COLOR_WHITE);
+        for (int i = 0; i < 3; i++) line->values[i] = levels[i];
+    }
+}
+
+// Copy every non-empty line to the display, one textured rectangle each;
+// transparent texels keep the frame behind the text
+void hud_draw(surface_t *display) {
+    rdpq_attach(display, NULL);
+    rdpq_set_mode_copy(true);
+    
+    for (int i = 0; i < HUD_LINES; i++) {
+        const hud_line_t *line = &lines[i];
+        if (!line->texture.buffer || !line->chars) continue;
+        
+        rdpq_tex_blit(&line->texture, line->x, line->y, &(rdpq_blitparms_t){
+            .width = line->chars * HUD_CHAR_WIDTH,
+        });
+    }
+    
+    rdpq_detach_wait();
+}
@@ -0,0 +1,28 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include <stdint.h>
+#include "platform.h"
+
+// =============================================================================
+// HUD layer
+//
+// Text is rasterized into small RGBA16 textures instead of onto the frame:
+// the title lines once at startup, the SHOW_FPS counters only when one of
+// their values changes. Each frame the RDP copies every line to the display
+// with one textured rectangle, skipping the transparent background, so the
+// HUD costs a handful of commands no matter how long the strings are.
+// Counters are formatted with integer arithmetic only (fractions as
+// fixed-point hundredths), no sprintf.
+// =============================================================================
+
+#define HUD_CHAR_WIDTH          8
+#define HUD_CHAR_HEIGHT         8
+#define HUD_MAX_CHARS           48      // Longest line a texture holds
+
+// Function prototypes
+void hud_init(void);
+void hud_set_stats(uint32_t frame, int position, int length, float peak, float avg, float bpm);
+void hud_draw(surface_t *display);
+
+#endif // HUD_H
@@ -4,6 +4,7 @@
 #include <stdint.h>
 
 // Audio parameters
+#define AUDIO_TRACK_SAMPLE_RATE 22050
 #define AUDIO_CHANNELS 1
 #define AUDIO_LENGTH 193968
 #define AUDIO_DURATION_MS 8796
@@ -4,6 +4,7 @@
 #include <stdint.h>
 
 // Audio parameters
+#define AUDIO_TRACK_SAMPLE_RATE 44100
 #define AUDIO_CHANNELS 1
 #define AUDIO_LENGTH 387937
 #define AUDIO_DURATION_MS 8796
@@ -0,0 +1,47 @@
+#include "lowres.h"
+#include "config.h"
+
+static surface_t targets[RENDER_RES_COUNT];
+
+// Target size per resolution; all keep the screen's 4:3
+void render_res_size(render_res_t resolution, int *width, int *height) {
+    static const int sizes[RENDER_RES_COUNT][2] = {
+        { SCREEN_WIDTH, SCREEN_HEIGHT },
+        { 256, 192 },
+        { 160, 120 },
+    };
+    
+    *width = sizes[resolution][0];
+    *height = sizes[resolution][1];
+}
+
+// Allocate the reduced targets on first use (96 KB + 37.5 KB)
+void lowres_init(void) {
+    for (int r = RENDER_FULL + 1; r < RENDER_RES_COUNT; r++) {
+        if (!targets[r].buffer) {
+            int width, height;
+            render_res_size((render_res_t)r, &width, &height);
+            targets[r] = surface_alloc(FMT_RGBA16, width, height);
+        }
+    }
+}
+
+// Offscreen surface for a reduced resolution; RENDER_FULL has none, the
+// mode draws straight to the display
+surface_t *lowres_target(render_res_t resolution) {
+    if (resolution == RENDER_FULL) return NULL;
+    if (!targets[resolution].buffer) lowres_init();
+    return &targets[resolution];
+}
+
+// Upscale a finished target over the whole display
+void lowres_present(surface_t *target, surface_t *display) {
+    rdpq_attach(display, NULL);
+    rdpq_set_mode_standard();
+    rdpq_mode_filter(FILTER_BILINEAR);
+    rdpq_tex_blit(target, 0, 0, &(rdpq_blitparms_t){
+        .scale_x = (float)display->width / target->width,
+        .scale_y = (float)display->height / target->height,
+    });
+    rdpq_detach_wait();
+}
@@ -0,0 +1,23 @@
+#ifndef LOWRES_H
+#define LOWRES_H
+
+#include "platform.h"
+#include "mode.h"
+
+// =============================================================================
+// Low-resolution render targets
+//
+// A mode whose render() lays out to its target's size can draw into a
+// smaller offscreen surface; the RDP then scales it to the display with
+// bilinear filtering in one textured blit. CPU fill and line costs drop with
+// the pixel count (160x120 is a quarter of the screen), and on a CRT the
+// softness of the upscale is barely visible.
+// =============================================================================
+
+// Function prototypes
+void lowres_init(void);
+surface_t *lowres_target(render_res_t resolution);
+void lowres_present(surface_t *target, surface_t *display);
+void render_res_size(render_res_t resolution, int *width, int *height);
+
+#endif // LOWRES_H
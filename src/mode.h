@@ -0,0 +1,64 @@
+#ifndef MODE_H
+#define MODE_H
+
+#include "platform.h"
+#include "beat.h"
+#include "history.h"
+
+// =============================================================================
+// Visualizer modes
+//
+// Each view (bars, waterfall, ...) is a descriptor of hooks over its own
+// statically preallocated state. The core runs the analysis once per frame
+// and hands every hook the same read-only view of the results; only the
+// active mode's update and render run, so an idle mode costs nothing.
+// =============================================================================
+
+// Size a mode is rendered at before reaching the display
+typedef enum {
+    RENDER_FULL,                // Straight to the display
+    RENDER_256x192,
+    RENDER_160x120,
+    RENDER_RES_COUNT
+} render_res_t;
+
+// Effects shed in order, each level keeping the previous ones off, when
+// frames run over budget (see governor.h). Bloom and trails are user
+// settings the levels only override, so raising quality restores them.
+typedef enum {
+    QUALITY_FULL,
+    QUALITY_NO_BLOOM,           // Bloom pass off; the cheaper glow stands in until the next level
+    QUALITY_NO_GLOW,            // Glow lines and passes off
+    QUALITY_NO_FLOW,            // Flow lines off
+    QUALITY_HALF_BARS,          // Every other bar only
+    QUALITY_NO_FEEDBACK,        // Trails off, which also lets reduced render sizes apply
+    QUALITY_LOW_RES,            // Rendered at 160x120 where the mode can
+    QUALITY_LEVEL_COUNT
+} quality_level_t;
+
+// Shared analysis results, owned by the visualizer core
+typedef struct {
+    const float *channels[2];           // Band levels per channel (left, right)
+    const float *bands;                 // Mid of both channels
+    float avg_intensity;                // Mean of bands
+    const beat_tracker_t *beat;
+    const band_history_t *history;      // Recent bands, newest first
+    sample_view_t samples;              // Track audio analyzed this frame
+    int sample_stride;                  // 1 = mono, 2 = interleaved L/R
+    int feedback;                       // Target already holds the faded last frame: don't clear
+    int bloom;                          // A bloom pass follows: skip per-primitive glow
+                                        // (both as drawn this frame, after the quality level)
+    quality_level_t quality;            // Set by the governor; modes drop effects from it
+} visualizer_state_t;
+
+typedef struct {
+    const char *name;
+    void (*init)(const visualizer_state_t *state);      // Allocate/reset own state (every mode, at startup)
+    void (*enter)(const visualizer_state_t *state);     // Became the active mode; may be NULL
+    void (*seek)(const visualizer_state_t *state);      // First frame after a jump in the track; may be NULL
+    void (*update)(const visualizer_state_t *state);    // Once per analysis frame while active
+    void (*render)(surface_t *surface, const visualizer_state_t *state);
+    render_res_t lowest;        // Smallest target render() lays out to; RENDER_FULL = screen size only
+} visualizer_mode_desc_t;
+
+#endif // MODE_H
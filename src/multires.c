@@ -0,0 +1,145 @@
+#include "multires.h"
+#include "decimator.h"
+#include "config.h"
+#include "platform.h"
+#include <math.h>
+#include <string.h>
+
+#define MULTIRES_MASK           (MULTIRES_FFT_SIZE - 1)
+
+// An octave is re-transformed once it has this many new samples; lower
+// octaves fill more slowly, so they update less often
+#define MULTIRES_HOP            (MULTIRES_FFT_SIZE / 4)
+
+// Input block pushed through the whole cascade at once
+#define MULTIRES_CHUNK          256
+
+#if (MULTIRES_FFT_SIZE & MULTIRES_MASK) || MULTIRES_FFT_SIZE > FFT_SIZE
+#error "MULTIRES_FFT_SIZE must be a power of two no larger than FFT_SIZE"
+#endif
+
+typedef struct {
+    int16_t ring[MULTIRES_FFT_SIZE];    // Last MULTIRES_FFT_SIZE samples
+    uint32_t write;
+    int pending;                        // Samples since the last transform
+} multires_octave_t;
+
+static multires_octave_t octaves[MULTIRES_OCTAVES];
+static halfband_t stages[MULTIRES_OCTAVES - 1];     // Stage k feeds octave k + 1
+
+// Last spectra, kept for octaves that don't update this call
+static float spectra[MULTIRES_OUTPUT_SIZE];
+
+static uint16_t bitrev_table[MULTIRES_FFT_SIZE];
+static float window_table[MULTIRES_FFT_SIZE];
+static fft_window_t window_type = FFT_WINDOW_COUNT;
+
+static float real[MULTIRES_FFT_SIZE];
+static float imag[MULTIRES_FFT_SIZE];
+
+static int multires_initialized = 0;
+
+void multires_init(void) {
+    if (multires_initialized) return;
+    
+    int j = 0;
+    for (int i = 0; i < MULTIRES_FFT_SIZE; i++) {
+        bitrev_table[i] = (uint16_t)j;
+        
+        int bit = MULTIRES_FFT_SIZE >> 1;
+        while (j & bit) {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j ^= bit;
+    }
+    
+    multires_initialized = 1;
+    multires_reset();
+    
+    #if DEBUG_ENABLED
+    debugf("Multires initialized (%d octaves of %d points)\n", MULTIRES_OCTAVES, MULTIRES_FFT_SIZE);
+    #endif
+}
+
+// Forget all history, e.g. after a seek
+void multires_reset(void) {
+    memset(octaves, 0, sizeof(octaves));
+    memset(spectra, 0, sizeof(spectra));
+    for (int k = 0; k < MULTIRES_OCTAVES - 1; k++) {
+        halfband_init(&stages[k]);
+    }
+}
+
+// Append to an octave's ring; only the last MULTIRES_FFT_SIZE samples matter
+static void octave_write(multires_octave_t *octave, const int16_t *samples, int count) {
+    octave->pending += count;
+    if (count > MULTIRES_FFT_SIZE) {
+        samples += count - MULTIRES_FFT_SIZE;
+        count = MULTIRES_FFT_SIZE;
+    }
+    
+    for (int n = 0; n < count; n++) {
+        octave->ring[octave->write & MULTIRES_MASK] = samples[n];
+        octave->write++;
+    }
+}
+
+// Run a block through the cascade, filling every octave's ring
+static void cascade_push(const int16_t *samples, int count) {
+    static int16_t scratch[2][MULTIRES_CHUNK / 2];
+    const int16_t *in = samples;
+    
+    octave_write(&octaves[0], samples, count);
+    
+    for (int k = 0; k < MULTIRES_OCTAVES - 1 && count > 0; k++) {
+        int16_t *out = scratch[k & 1];
+        count = halfband_process(&stages[k], in, count, out);
+        octave_write(&octaves[k + 1], out, count);
+        in = out;
+    }
+}
+
+// Windowed, bit-reversed load of an octave's ring, oldest sample first
+static void octave_transform(multires_octave_t *octave, float *output) {
+    for (int i = 0; i < MULTIRES_FFT_SIZE; i++) {
+        real[bitrev_table[i]] = octave->ring[(octave->write + i) & MULTIRES_MASK] * window_table[i];
+    }
+    memset(imag, 0, sizeof(imag));
+    
+    fft_transform(real, imag, MULTIRES_FFT_SIZE);
+    
+    for (int i = 0; i < MULTIRES_BINS; i++) {
+        output[i] = sqrtf(real[i] * real[i] + imag[i] * imag[i]);
+    }
+    
+    octave->pending = 0;
+}
+
+// Feed the frame's new samples and return the octave spectra
+// (MULTIRES_OUTPUT_SIZE magnitudes on the FFT_SIZE transform's scale)
+void multires_compute(const sample_view_t *view, float *output) {
+    if (!multires_initialized) multires_init();
+    
+    if (window_type != fft_get_window()) {
+        window_type = fft_get_window();
+        fft_window_for_size(window_table, MULTIRES_FFT_SIZE);
+    }
+    
+    const int16_t *spans[2] = { view->first, view->second };
+    int lengths[2] = { view->first_length, view->second_length };
+    for (int s = 0; s < 2; s++) {
+        for (int n = 0; n < lengths[s]; n += MULTIRES_CHUNK) {
+            int count = lengths[s] - n < MULTIRES_CHUNK ? lengths[s] - n : MULTIRES_CHUNK;
+            cascade_push(spans[s] + n, count);
+        }
+    }
+    
+    for (int k = 0; k < MULTIRES_OCTAVES; k++) {
+        if (octaves[k].pending >= MULTIRES_HOP) {
+            octave_transform(&octaves[k], &spectra[k * MULTIRES_BINS]);
+        }
+    }
+    
+    memcpy(output, spectra, sizeof(spectra));
+}
@@ -0,0 +1,24 @@
+#ifndef MULTIRES_H
+#define MULTIRES_H
+
+#include "audio.h"
+
+// =============================================================================
+// Multi-resolution (constant-Q style) spectrum analyzer
+//
+// The input stream runs through a cascade of half-band 2x decimators, giving
+// MULTIRES_OCTAVES streams at AUDIO_SAMPLE_RATE / 2^k. Each keeps its last
+// MULTIRES_FFT_SIZE samples, so the same short FFT spans a long window on the
+// bass octaves and a short one on the treble. Output is the octave spectra
+// laid end to end, octave 0 first, for filterbank_apply_multires.
+// =============================================================================
+
+#define MULTIRES_BINS           (MULTIRES_FFT_SIZE / 2)
+#define MULTIRES_OUTPUT_SIZE    (MULTIRES_OCTAVES * MULTIRES_BINS)
+
+// Function prototypes
+void multires_init(void);
+void multires_reset(void);
+void multires_compute(const sample_view_t *view, float *output);
+
+#endif // MULTIRES_H
@@ -0,0 +1,98 @@
+#include "peaks.h"
+#include "config.h"
+#include "platform.h"
+
+// Mono sample, or the mid of an interleaved pair
+static inline int track_sample(const audio_track_t *track, int stride, int frame) {
+    const int16_t *p = &track->samples[frame * stride];
+    return stride == 2 ? (p[0] + p[1]) >> 1 : p[0];
+}
+
+void peaks_build(peak_pyramid_t *pyramid, const audio_track_t *track) {
+    int stride = track->channels == 2 ? 2 : 1;
+    int shift = PEAKS_MIN_BLOCK_SHIFT;
+    while ((track->length >> shift) >= PEAKS_BASE_ENTRIES) shift++;
+    
+    pyramid->track = track;
+    pyramid->block_shift = shift;
+    pyramid->levels = 0;
+    if (!track->samples || track->length <= 0) return;
+    
+    // Level 0: scan the samples once
+    int count = ((track->length - 1) >> shift) + 1;
+    for (int e = 0; e < count; e++) {
+        int start = e << shift;
+        int end = start + (1 << shift) < track->length ? start + (1 << shift) : track->length;
+        int lo = 32767, hi = -32768;
+        
+        for (int n = start; n < end; n++) {
+            int v = track_sample(track, stride, n);
+            if (v < lo) lo = v;
+            if (v > hi) hi = v;
+        }
+        pyramid->entries[e].min = (int8_t)(lo >> 8);
+        pyramid->entries[e].max = (int8_t)(hi >> 8);
+    }
+    pyramid->offsets[0] = 0;
+    pyramid->counts[0] = count;
+    
+    // Upper levels: merge pairs until one entry covers the whole track
+    int level = 1;
+    while (count > 1 && level < PEAKS_MAX_LEVELS) {
+        const peak_t *below = &pyramid->entries[pyramid->offsets[level - 1]];
+        int offset = pyramid->offsets[level - 1] + count;
+        peak_t *out = &pyramid->entries[offset];
+        
+        count = (count + 1) >> 1;
+        for (int e = 0; e < count; e++) {
+            peak_t a = below[2 * e];
+            peak_t b = (2 * e + 1 < pyramid->counts[level - 1]) ? below[2 * e + 1] : a;
+            out[e].min = a.min < b.min ? a.min : b.min;
+            out[e].max = a.max > b.max ? a.max : b.max;
+        }
+        pyramid->offsets[level] = offset;
+        pyramid->counts[level] = count;
+        level++;
+    }
+    pyramid->levels = level;
+    
+    #if DEBUG_ENABLED
+    debugf("Peaks built (%d levels, %d frames per block)\n", pyramid->levels, 1 << shift);
+    #endif
+}
+
+// Min/max (int16 scale) over frames [start, end). Ranges shorter than a
+// block read the samples; longer ones merge whole blocks of the coarsest
+// level that still fits, so edges are rounded out to block boundaries.
+void peaks_range(const peak_pyramid_t *pyramid, int start, int end, int *min, int *max) {
+    int lo = 32767, hi = -32768;
+    int frames = end - start;
+    
+    if (pyramid->levels == 0 || frames <= 0) {
+        lo = hi = 0;
+    } else if (frames < (1 << pyramid->block_shift)) {
+        const audio_track_t *track = pyramid->track;
+        int stride = track->channels == 2 ? 2 : 1;
+        for (int n = start; n < end; n++) {
+            int v = track_sample(track, stride, n);
+            if (v < lo) lo = v;
+            if (v > hi) hi = v;
+        }
+    } else {
+        int level = 0;
+        while (level + 1 < pyramid->levels && (1 << (pyramid->block_shift + level + 1)) <= frames) level++;
+        
+        int shift = pyramid->block_shift + level;
+        const peak_t *entries = &pyramid->entries[pyramid->offsets[level]];
+        int last = (end - 1) >> shift;
+        if (last >= pyramid->counts[level]) last = pyramid->counts[level] - 1;
+        
+        for (int e = start >> shift; e <= last; e++) {
+            if (entries[e].min * 256 < lo) lo = entries[e].min * 256;
+            if (entries[e].max * 256 + 255 > hi) hi = entries[e].max * 256 + 255;
+        }
+    }
+    
+    *min = lo;
+    *max = hi;
+}
@@ -0,0 +1,41 @@
+#ifndef PEAKS_H
+#define PEAKS_H
+
+#include <stdint.h>
+#include "audio.h"
+
+// =============================================================================
+// Waveform peak pyramid
+//
+// Built once per track: level 0 holds the min/max of each block of
+// 2^block_shift frames, and every level above merges pairs of the one
+// below, down to a single entry for the whole track. Any range of the
+// track then resolves to at most three entries of the level whose blocks
+// are just shorter than the range, so drawing an overview costs O(columns)
+// at any zoom. Levels are stored back to back in a fixed buffer; peaks are
+// int8 (the sample's high byte), 4 KB in total for any track length.
+// =============================================================================
+
+#define PEAKS_BASE_ENTRIES      1024    // Level 0 capacity, power of two
+#define PEAKS_MAX_LEVELS        11      // log2(PEAKS_BASE_ENTRIES) + 1
+#define PEAKS_MIN_BLOCK_SHIFT   6       // Level 0 blocks are at least 64 frames
+
+typedef struct {
+    int8_t min;
+    int8_t max;
+} peak_t;
+
+typedef struct {
+    peak_t entries[2 * PEAKS_BASE_ENTRIES];
+    int offsets[PEAKS_MAX_LEVELS];      // First entry of each level
+    int counts[PEAKS_MAX_LEVELS];
+    int levels;
+    int block_shift;                    // Frames per level-0 entry = 1 << block_shift
+    const audio_track_t *track;
+} peak_pyramid_t;
+
+// Function prototypes
+void peaks_build(peak_pyramid_t *pyramid, const audio_track_t *track);
+void peaks_range(const peak_pyramid_t *pyramid, int start, int end, int *min, int *max);
+
+#endif // PEAKS_H
@@ -0,0 +1,37 @@
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+// =============================================================================
+// Platform abstraction
+//
+// On the console this pulls in the real libdragon. For the host-native build
+// (make host) the Makefile adds -Ihost, so <libdragon.h> resolves to the
+// minimal stub in host/libdragon.h which renders into a RAM framebuffer.
+// =============================================================================
+
+#include <stdint.h>
+#include <libdragon.h>
+
+#ifndef PLATFORM_HOST
+#define PLATFORM_HOST           0
+#endif
+
+#if PLATFORM_HOST
+#define PLATFORM_NAME           "host"
+#else
+#define PLATFORM_NAME           "n64"
+// The VR4300 runs at 93.75 MHz; CP0 Count (get_ticks) advances every 2 cycles
+#define PLATFORM_CPU_HZ         93750000
+#define PLATFORM_CYCLES_PER_TICK 2
+#endif
+
+// Monotonic tick counter (CP0 count on the VR4300, nanoseconds on the host)
+static inline uint64_t platform_ticks(void) {
+    return get_ticks();
+}
+
+static inline uint64_t platform_ticks_to_us(uint64_t ticks) {
+    return ticks * 1000000ULL / TICKS_PER_SECOND;
+}
+
+#endif // PLATFORM_H
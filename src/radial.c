@@ -0,0 +1,123 @@
+#include "radial.h"
+#include "bars.h"
+#include "config.h"
+#include <math.h>
+#include <string.h>
+
+#define RADIAL_HALF_WIDTH       1.5f    // Bar half thickness (px)
+#define RADIAL_GLOW             1.0f    // Glow margin around each bar (px)
+#define RADIAL_DECAY            0.85f   // Per-frame fall of a bar, it rises instantly
+#define RADIAL_LEVEL_FULL       6.0f    // Band level drawn at full length
+
+#define Q16(x)                  ((int32_t)lrintf((x) * 65536.0f))
+
+// Per-bar geometry, Q16 screen coordinates
+typedef struct {
+    int32_t base_x, base_y;     // Inner endpoint: center + RADIAL_INNER * dir
+    int32_t dir_x, dir_y;       // Unit direction
+    int32_t side_x, side_y;     // Half-width across the bar
+    int32_t glow_x, glow_y;     // Half-width plus the glow margin
+    int32_t tip_x, tip_y;       // Glow margin along the bar
+} radial_spoke_t;
+
+static radial_spoke_t spokes[RADIAL_BARS];
+static float lengths[RADIAL_BARS];
+
+static void radial_init(const visualizer_state_t *state) {
+    (void)state;
+    
+    // Lowest band straight up, then clockwise
+    for (int i = 0; i < RADIAL_BARS; i++) {
+        float angle = (i + 0.5f) * (2.0f * 3.14159265f / RADIAL_BARS) - 3.14159265f * 0.5f;
+        float dx = cosf(angle);
+        float dy = sinf(angle);
+        radial_spoke_t *s = &spokes[i];
+        
+        s->base_x = Q16(SCREEN_WIDTH / 2 + dx * RADIAL_INNER);
+        s->base_y = Q16(CENTER_Y + dy * RADIAL_INNER);
+        s->dir_x = Q16(dx);
+        s->dir_y = Q16(dy);
+        s->side_x = Q16(-dy * RADIAL_HALF_WIDTH);
+        s->side_y = Q16(dx * RADIAL_HALF_WIDTH);
+        s->glow_x = Q16(-dy * (RADIAL_HALF_WIDTH + RADIAL_GLOW));
+        s->glow_y = Q16(dx * (RADIAL_HALF_WIDTH + RADIAL_GLOW));
+        s->tip_x = Q16(dx * RADIAL_GLOW);
+        s->tip_y = Q16(dy * RADIAL_GLOW);
+    }
+    
+    memset(lengths, 0, sizeof(lengths));
+}
+
+static void radial_update(const visualizer_state_t *state) {
+    for (int i = 0; i < RADIAL_BARS; i++) {
+        float target = state->bands[i] * (RADIAL_MAX_LENGTH / RADIAL_LEVEL_FULL);
+        float length = lengths[i] * RADIAL_DECAY;
+        if (target > length) length = target;
+        lengths[i] = CLAMP(length, 2.0f, (float)RADIAL_MAX_LENGTH);
+    }
+}
+
+// Q16 screen coordinates to the target's pixels; the target may be reduced
+static float scale_x, scale_y;
+
+// Quad from inner (x0, y0) to outer (x1, y1), `side` wide on each side
+static void draw_spoke(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t side_x, int32_t side_y) {
+    float a[2] = { (x0 + side_x) * scale_x, (y0 + side_y) * scale_y };
+    float b[2] = { (x0 - side_x) * scale_x, (y0 - side_y) * scale_y };
+    float c[2] = { (x1 - side_x) * scale_x, (y1 - side_y) * scale_y };
+    float d[2] = { (x1 + side_x) * scale_x, (y1 + side_y) * scale_y };
+    
+    rdpq_triangle(&TRIFMT_FILL, a, b, c);
+    rdpq_triangle(&TRIFMT_FILL, a, c, d);
+}
+
+static void radial_render(surface_t *surface, const visualizer_state_t *state) {
+    scale_x = (float)surface->width / (SCREEN_WIDTH * 65536.0f);
+    scale_y = (float)surface->height / (SCREEN_HEIGHT * 65536.0f);
+    
+    if (state->feedback) {
+        rdpq_attach(surface, NULL);
+    } else {
+        rdpq_attach_clear(surface, NULL);
+    }
+    rdpq_set_mode_fill(RGBA32(0, 0, 0, 0xFF));
+    int step = state->quality >= QUALITY_HALF_BARS ? 2 : 1;
+    
+    #if GLOW_ENABLED
+    // Dimmed, wider copies first so every bar sits on top of all the glow
+    int glow = !state->bloom && state->quality < QUALITY_NO_GLOW;
+    for (int i = 0; i < RADIAL_BARS && glow; i += step) {
+        const radial_spoke_t *s = &spokes[i];
+        int length = (int)lengths[i];
+        color_t color = color_from_packed16(get_neon_color(i, lengths[i] / RADIAL_MAX_LENGTH));
+        
+        rdpq_set_fill_color(RGBA32(color.r >> 1, color.g >> 1, color.b >> 1, 0xFF));
+        draw_spoke(s->base_x - s->tip_x, s->base_y - s->tip_y,
+                   s->base_x + s->dir_x * length + s->tip_x, s->base_y + s->dir_y * length + s->tip_y,
+                   s->glow_x, s->glow_y);
+    }
+    #endif
+    
+    for (int i = 0; i < RADIAL_BARS; i += step) {
+        const radial_spoke_t *s = &spokes[i];
+        int length = (int)lengths[i];
+        
+        rdpq_set_fill_color(color_from_packed16(get_neon_color(i, lengths[i] / RADIAL_MAX_LENGTH)));
+        draw_spoke(s->base_x, s->base_y,
+                   s->base_x + s->dir_x * length, s->base_y + s->dir_y * length,
+                   s->side_x, s->side_y);
+    }
+    
+    // The HUD's cached textures are blitted on top by the visualizer core
+    rdpq_detach_wait();
+}
+
+const visualizer_mode_desc_t radial_mode = {
+    "radial",
+    radial_init,
+    NULL,
+    NULL,
+    radial_update,
+    radial_render,
+    RENDER_160x120,
+};
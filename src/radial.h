@@ -0,0 +1,23 @@
+#ifndef RADIAL_H
+#define RADIAL_H
+
+#include "mode.h"
+
+// =============================================================================
+// Radial spectrum
+//
+// The bands radiate from the screen center as thick rotated bars. Every
+// angle-dependent quantity (unit direction, inner endpoint, half-width and
+// glow offsets) is computed once at mode init into a Q16 table, so a frame
+// costs one multiply-add per endpoint coordinate and no trig. Each bar is a
+// quad of two rdpq triangles, so its thickness and angle don't change the
+// cost on the RDP.
+// =============================================================================
+
+#define RADIAL_BARS             NUM_FREQUENCY_BINS
+#define RADIAL_INNER            28      // Radius where the bars start (px)
+#define RADIAL_MAX_LENGTH       88      // Longest bar (px); inner + max stays on screen
+
+extern const visualizer_mode_desc_t radial_mode;
+
+#endif // RADIAL_H
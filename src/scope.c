@@ -0,0 +1,141 @@
+#include "scope.h"
+
+#define SCOPE_HALF_HEIGHT       (MAX_BAR_HEIGHT / 2)
+#define SCOPE_GAIN              2       // Full scale / SCOPE_GAIN reaches the edge
+
+// Screen rows of each column's span, top <= bottom
+static int16_t column_top[SCOPE_COLUMNS];
+static int16_t column_bottom[SCOPE_COLUMNS];
+
+// Mono sample, or the mid of an interleaved pair
+static inline int scope_sample(const int16_t *p, int stride) {
+    return stride == 2 ? (p[0] + p[1]) >> 1 : p[0];
+}
+
+static inline int scope_row(int sample) {
+    int y = CENTER_Y - ((sample * SCOPE_HALF_HEIGHT * SCOPE_GAIN) >> 15);
+    return CLAMP(y, CENTER_Y - SCOPE_HALF_HEIGHT, CENTER_Y + SCOPE_HALF_HEIGHT);
+}
+
+// Frame index of the first rising zero crossing within the first `search`
+// frames, or 0 to free-run when there is none
+int scope_trigger(const sample_view_t *view, int stride, int search) {
+    const int16_t *spans[2] = { view->first, view->second };
+    int lengths[2] = { view->first_length, view->second_length };
+    int armed = 0;
+    int frame = 0;
+    
+    for (int s = 0; s < 2; s++) {
+        for (int i = 0; i < lengths[s] && frame < search; i += stride, frame++) {
+            int v = scope_sample(&spans[s][i], stride);
+            if (v < -SCOPE_HYSTERESIS) {
+                armed = 1;
+            } else if (armed && v >= 0) {
+                return frame;
+            }
+        }
+    }
+    return 0;
+}
+
+// Reduce the view's first `frames` frames to one min/max span per column
+void scope_decimate(const sample_view_t *view, int stride, int frames) {
+    const int16_t *spans[2] = { view->first, view->second };
+    int lengths[2] = { view->first_length, view->second_length };
+    uint32_t step = ((uint32_t)SCOPE_COLUMNS << 16) / (uint32_t)frames;   // Columns per frame, Q16
+    uint32_t position = 0;
+    int column = 0;
+    
+    int last = view->first_length ? scope_sample(view->first, stride) : 0;
+    int lo = last;
+    int hi = last;
+    
+    for (int s = 0; s < 2; s++) {
+        const int16_t *p = spans[s];
+        for (int i = 0; i < lengths[s] && frames > 0; i += stride, frames--) {
+            int target = (int)(position >> 16);
+            position += step;
+            
+            // Close finished columns; the next one starts at the last sample
+            while (column < target) {
+                column_top[column] = (int16_t)scope_row(hi);
+                column_bottom[column] = (int16_t)scope_row(lo);
+                column++;
+                lo = hi = last;
+            }
+            
+            int v = scope_sample(&p[i], stride);
+            if (v < lo) lo = v;
+            if (v > hi) hi = v;
+            last = v;
+        }
+    }
+    
+    while (column < SCOPE_COLUMNS) {
+        column_top[column] = (int16_t)scope_row(hi);
+        column_bottom[column] = (int16_t)scope_row(lo);
+        column++;
+        lo = hi = last;
+    }
+}
+
+// One vertical span per column, written straight into the 16-bit surface
+void scope_draw(surface_t *surface, uint16_t color) {
+    int pitch = surface->stride / 2;
+    uint16_t *pixels = (uint16_t *)surface->buffer;
+    
+    for (int x = 0; x < SCOPE_COLUMNS; x++) {
+        uint16_t *p = &pixels[column_top[x] * pitch + x];
+        for (int y = column_top[x]; y <= column_bottom[x]; y++) {
+            *p = color;
+            p += pitch;
+        }
+    }
+}
+
+static void scope_init(const visualizer_state_t *state) {
+    (void)state;
+    for (int x = 0; x < SCOPE_COLUMNS; x++) {
+        column_top[x] = column_bottom[x] = CENTER_Y;
+    }
+}
+
+// Trigger in the frame's leading samples, then show SCOPE_SPAN after it
+static void scope_update(const visualizer_state_t *state) {
+    int stride = state->sample_stride;
+    int frames = (state->samples.first_length + state->samples.second_length) / stride;
+    if (frames == 0) return;
+    
+    // Tracks at 2x/4x the analysis rate show the same time span
+    int span = SCOPE_SPAN * frames / BUFFER_SIZE;
+    if (span < 1 || span > frames) span = frames;
+    
+    int start = scope_trigger(&state->samples, stride, frames - span + 1);
+    
+    sample_view_t window;
+    sample_view_slice(&window, &state->samples, start * stride, span * stride);
+    scope_decimate(&window, stride, span);
+}
+
+static void scope_render(surface_t *surface, const visualizer_state_t *state) {
+    if (!state->feedback) {
+        graphics_fill_screen(surface, COLOR_BLACK);
+    }
+    
+    #if CENTER_LINE_ENABLED
+    graphics_draw_line(surface, 0, CENTER_Y, SCREEN_WIDTH, CENTER_Y, COLOR_PURPLE);
+    #endif
+    
+    // Flash on the beat like the bars' center line
+    scope_draw(surface, state->beat->pulse > 0.5f ? COLOR_PINK : COLOR_TEAL);
+}
+
+const visualizer_mode_desc_t scope_mode = {
+    "scope",
+    scope_init,
+    NULL,
+    NULL,
+    scope_update,
+    scope_render,
+    RENDER_FULL,
+};
@@ -0,0 +1,30 @@
+#ifndef SCOPE_H
+#define SCOPE_H
+
+#include "audio.h"
+#include "config.h"
+#include "mode.h"
+
+// =============================================================================
+// Triggered oscilloscope
+//
+// Each frame looks for a rising zero crossing (with hysteresis, so noise
+// around zero can't trigger) near the start of the frame's samples, then
+// reduces the SCOPE_SPAN samples after it to one min/max pair per screen
+// column, straight from the int16 view. Every column is drawn as a single
+// vertical span; each span also covers the previous column's last sample,
+// so steep edges stay connected without drawing line segments.
+// =============================================================================
+
+#define SCOPE_COLUMNS           SCREEN_WIDTH
+#define SCOPE_SPAN              (BUFFER_SIZE / 2)   // Analysis-rate samples on screen (~23 ms)
+#define SCOPE_HYSTERESIS        512                 // Must dip this far below zero to arm
+
+extern const visualizer_mode_desc_t scope_mode;
+
+// Function prototypes
+int scope_trigger(const sample_view_t *view, int stride, int search);
+void scope_decimate(const sample_view_t *view, int stride, int frames);
+void scope_draw(surface_t *surface, uint16_t color);
+
+#endif // SCOPE_H
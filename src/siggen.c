@@ -0,0 +1,182 @@
+#include "siggen.h"
+#include <math.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Q15 sine table shared by all generators
+static int16_t sine_table[SIGGEN_SINE_SIZE];
+static int sine_initialized = 0;
+
+static void sine_init(void) {
+    if (sine_initialized) return;
+    
+    for (int i = 0; i < SIGGEN_SINE_SIZE; i++) {
+        sine_table[i] = (int16_t)lrintf(sinf(2.0f * M_PI * i / SIGGEN_SINE_SIZE) * 32767.0f);
+    }
+    
+    sine_initialized = 1;
+}
+
+static inline int32_t sine_lookup(uint32_t phase) {
+    return sine_table[phase >> (32 - SIGGEN_SINE_BITS)];
+}
+
+static uint32_t hz_to_increment(const siggen_t *gen, float freq_hz) {
+    return (uint32_t)(freq_hz / gen->sample_rate * 4294967296.0);
+}
+
+static int32_t to_q15(float amplitude) {
+    if (amplitude < 0.0f) amplitude = 0.0f;
+    if (amplitude > 1.0f) amplitude = 1.0f;
+    return (int32_t)(amplitude * 32767.0f);
+}
+
+void siggen_init(siggen_t *gen, int sample_rate, uint32_t seed) {
+    sine_init();
+    
+    memset(gen, 0, sizeof(*gen));
+    gen->sample_rate = sample_rate;
+    gen->noise_seed = seed ? seed : 1;
+}
+
+int siggen_add_tone(siggen_t *gen, float freq_hz, float amplitude) {
+    return siggen_add_sweep(gen, freq_hz, freq_hz, 0.0f, amplitude);
+}
+
+int siggen_add_sweep(siggen_t *gen, float from_hz, float to_hz, float seconds, float amplitude) {
+    if (gen->num_osc >= SIGGEN_MAX_OSCILLATORS) return -1;
+    
+    siggen_osc_t *osc = &gen->osc[gen->num_osc];
+    osc->phase = 0;
+    osc->increment_min = hz_to_increment(gen, from_hz);
+    osc->increment_max = hz_to_increment(gen, to_hz);
+    osc->increment = osc->increment_min;
+    osc->amplitude = to_q15(amplitude);
+    
+    int samples = (int)(seconds * gen->sample_rate);
+    osc->sweep = (samples > 0 && to_hz > from_hz)
+        ? (int32_t)((osc->increment_max - osc->increment_min) / (uint32_t)samples)
+        : 0;
+    
+    return gen->num_osc++;
+}
+
+void siggen_set_noise(siggen_t *gen, float amplitude) {
+    gen->noise_amplitude = to_q15(amplitude);
+}
+
+void siggen_set_drum(siggen_t *gen, float bpm, float pitch_hz, float decay_ms, float amplitude) {
+    gen->drum_period = bpm > 0.0f ? (uint32_t)(gen->sample_rate * 60.0f / bpm) : 0;
+    gen->drum_counter = 0;
+    gen->drum_start_increment = hz_to_increment(gen, pitch_hz);
+    gen->drum_envelope = 0;
+    gen->drum_amplitude = to_q15(amplitude);
+    
+    // Per-sample multiplier that reaches 1/e after decay_ms
+    float decay_samples = decay_ms * 0.001f * gen->sample_rate;
+    gen->drum_decay = decay_samples > 1.0f ? (int32_t)(expf(-1.0f / decay_samples) * 32768.0f) : 0;
+}
+
+// Samples mixed per block; each source runs its own tight loop over the block
+#define SIGGEN_BLOCK            64
+
+static void render_oscillator(siggen_osc_t *osc, int32_t *mix, int count) {
+    uint32_t phase = osc->phase;
+    uint32_t increment = osc->increment;
+    int32_t amplitude = osc->amplitude;
+    
+    if (!osc->sweep) {
+        for (int n = 0; n < count; n++) {
+            mix[n] += (sine_lookup(phase) * amplitude) >> 15;
+            phase += increment;
+        }
+    } else {
+        for (int n = 0; n < count; n++) {
+            mix[n] += (sine_lookup(phase) * amplitude) >> 15;
+            phase += increment;
+            increment += osc->sweep;
+            if (increment > osc->increment_max) increment = osc->increment_min;
+        }
+    }
+    
+    osc->phase = phase;
+    osc->increment = increment;
+}
+
+static void render_noise(siggen_t *gen, int32_t *mix, int count) {
+    uint32_t seed = gen->noise_seed;
+    int32_t amplitude = gen->noise_amplitude;
+    
+    for (int n = 0; n < count; n++) {
+        seed = seed * 1664525u + 1013904223u;
+        mix[n] += ((int32_t)(int16_t)(seed >> 16) * amplitude) >> 15;
+    }
+    
+    gen->noise_seed = seed;
+}
+
+static void render_drum(siggen_t *gen, int32_t *mix, int count) {
+    for (int n = 0; n < count; n++) {
+        if (gen->drum_counter == 0) {
+            gen->drum_envelope = 32767;
+            gen->drum_phase = 0;
+            gen->drum_increment = gen->drum_start_increment;
+        }
+        if (++gen->drum_counter >= gen->drum_period) gen->drum_counter = 0;
+        
+        if (gen->drum_envelope) {
+            int32_t level = (gen->drum_envelope * gen->drum_amplitude) >> 15;
+            mix[n] += (sine_lookup(gen->drum_phase) * level) >> 15;
+            gen->drum_phase += gen->drum_increment;
+            gen->drum_increment -= gen->drum_increment >> 11;   // Pitch drop
+            gen->drum_envelope = (gen->drum_envelope * gen->drum_decay) >> 15;
+        }
+    }
+}
+
+void siggen_render(siggen_t *gen, int16_t *out, int count) {
+    int32_t mix[SIGGEN_BLOCK];
+    
+    while (count > 0) {
+        int block = count < SIGGEN_BLOCK ? count : SIGGEN_BLOCK;
+        memset(mix, 0, block * sizeof(int32_t));
+        
+        for (int i = 0; i < gen->num_osc; i++) {
+            render_oscillator(&gen->osc[i], mix, block);
+        }
+        if (gen->noise_amplitude) render_noise(gen, mix, block);
+        if (gen->drum_period) render_drum(gen, mix, block);
+        
+        // Saturate to int16
+        for (int n = 0; n < block; n++) {
+            int32_t v = mix[n];
+            out[n] = (int16_t)(v > 32767 ? 32767 : (v < -32768 ? -32768 : v));
+        }
+        
+        out += block;
+        count -= block;
+    }
+}
+
+void siggen_demo(siggen_t *gen, int sample_rate) {
+    siggen_init(gen, sample_rate, 0x1D872B41);
+    
+    // Bass
+    siggen_add_tone(gen, 55.0f, 0.20f);
+    siggen_add_tone(gen, 110.0f, 0.12f);
+    
+    // A major chord
+    siggen_add_tone(gen, 440.0f, 0.06f);
+    siggen_add_tone(gen, 554.37f, 0.05f);
+    siggen_add_tone(gen, 659.25f, 0.05f);
+    
+    // Slow sweep across the spectrum
+    siggen_add_sweep(gen, 200.0f, sample_rate * 0.4f, 4.0f, 0.06f);
+    
+    // Hi-hat hiss and a 120 BPM kick
+    siggen_set_noise(gen, 0.03f);
+    siggen_set_drum(gen, 120.0f, 150.0f, 60.0f, 0.45f);
+}
@@ -0,0 +1,59 @@
+#ifndef SIGGEN_H
+#define SIGGEN_H
+
+#include <stdint.h>
+
+// =============================================================================
+// Synthetic test-signal generator
+//
+// Integer-only synthesis of int16 samples: a bank of phase-accumulator
+// oscillators (fixed tones or linear sweeps) over a shared Q15 sine table,
+// LCG white noise and a decaying "kick" drum. Floats are only used when
+// configuring; siggen_render is pure integer math.
+// =============================================================================
+
+#define SIGGEN_MAX_OSCILLATORS  8
+#define SIGGEN_SINE_BITS        10
+#define SIGGEN_SINE_SIZE        (1 << SIGGEN_SINE_BITS)
+
+typedef struct {
+    uint32_t phase;             // 0..2^32 = one period
+    uint32_t increment;         // Phase step per sample
+    int32_t sweep;              // Added to increment every sample (0 = fixed tone)
+    uint32_t increment_min;     // Sweep restarts here...
+    uint32_t increment_max;     // ...after passing this
+    int32_t amplitude;          // Q15
+} siggen_osc_t;
+
+typedef struct {
+    int sample_rate;
+    siggen_osc_t osc[SIGGEN_MAX_OSCILLATORS];
+    int num_osc;
+    
+    // White noise
+    uint32_t noise_seed;
+    int32_t noise_amplitude;    // Q15
+    
+    // Drum: pitch-dropping sine with an exponential envelope
+    uint32_t drum_period;       // Samples between hits (0 = off)
+    uint32_t drum_counter;
+    uint32_t drum_phase;
+    uint32_t drum_increment;
+    uint32_t drum_start_increment;
+    int32_t drum_envelope;      // Q15
+    int32_t drum_decay;         // Q15 multiplier per sample
+    int32_t drum_amplitude;     // Q15
+} siggen_t;
+
+// Function prototypes
+void siggen_init(siggen_t *gen, int sample_rate, uint32_t seed);
+int siggen_add_tone(siggen_t *gen, float freq_hz, float amplitude);
+int siggen_add_sweep(siggen_t *gen, float from_hz, float to_hz, float seconds, float amplitude);
+void siggen_set_noise(siggen_t *gen, float amplitude);
+void siggen_set_drum(siggen_t *gen, float bpm, float pitch_hz, float decay_ms, float amplitude);
+void siggen_render(siggen_t *gen, int16_t *out, int count);
+
+// Demo preset: bass, a chord, a slow sweep, hi-hat noise and a 120 BPM kick
+void siggen_demo(siggen_t *gen, int sample_rate);
+
+#endif // SIGGEN_H
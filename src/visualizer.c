@@ -0,0 +1,391 @@
+#include "platform.h"
+#include <malloc.h>
+#include <math.h>
+#include <string.h>
+#include "config.h"
+#include "audio.h"
+#include "visualizer.h"
+#include "beat.h"
+#include "history.h"
+#include "bars.h"
+#include "waterfall.h"
+#include "scope.h"
+#include "peaks.h"
+#include "radial.h"
+#include "feedback.h"
+#include "bloom.h"
+#include "lowres.h"
+#include "governor.h"
+#include "hud.h"
+#include TRACK_HEADER
+
+// Global variables
+static surface_t *disp = 0;
+static uint32_t frame_counter = 0;
+static audio_track_t music_track;
+static float channel_data[2][NUM_FREQUENCY_BINS];
+static float frequency_data[NUM_FREQUENCY_BINS];    // Mid of both channels
+static beat_tracker_t beat_tracker;
+static band_history_t band_history;
+static visualizer_mode_t visualizer_mode = VISUALIZER_MODE;
+static int seek_pending = 0;    // The next analyzed frame follows a jump
+static int scrubbing = 0;       // Z + D-pad held: position-only updates
+static int feedback_enabled = 0;    // User settings; the quality level may
+static int bloom_enabled = 0;       // still keep them off for a frame
+static render_res_t mode_resolution[VISUALIZER_MODE_COUNT];    // Chosen per mode
+static governor_t governor;
+static int governor_enabled = GOVERNOR_ENABLED;
+
+// What every mode sees; the pointers never change, only the data behind them
+static visualizer_state_t visualizer_state = {
+    { channel_data[0], channel_data[1] },
+    frequency_data,
+    0.0f,
+    &beat_tracker,
+    &band_history,
+    { NULL, 0, NULL, 0 },
+    1,
+    0,
+    0,
+    QUALITY_FULL,
+};
+
+// Whole-track waveform strip along the bottom, with a playhead. Its columns
+// are resolved from the peak pyramid once per track; a frame only draws them.
+#define OVERVIEW_X              10
+#define OVERVIEW_WIDTH          (SCREEN_WIDTH - 20)
+#define OVERVIEW_CENTER         (SCREEN_HEIGHT - 12)
+#define OVERVIEW_HALF_HEIGHT    6
+
+static peak_pyramid_t track_peaks;
+static uint8_t overview_top[OVERVIEW_WIDTH];
+static uint8_t overview_bottom[OVERVIEW_WIDTH];
+
+// Registry, indexed by visualizer_mode_t
+static const visualizer_mode_desc_t *const modes[VISUALIZER_MODE_COUNT] = {
+    &bars_mode,
+    &waterfall_mode,
+    &scope_mode,
+    &radial_mode,
+};
+
+// Peak pyramid of the track and the overview columns at full zoom
+static void build_overview(void) {
+    peaks_build(&track_peaks, &music_track);
+    
+    for (int x = 0; x < OVERVIEW_WIDTH; x++) {
+        int start = (int)((int64_t)x * music_track.length / OVERVIEW_WIDTH);
+        int end = (int)((int64_t)(x + 1) * music_track.length / OVERVIEW_WIDTH);
+        int lo, hi;
+        
+        peaks_range(&track_peaks, start, end, &lo, &hi);
+        overview_top[x] = (uint8_t)(OVERVIEW_CENTER - ((hi * OVERVIEW_HALF_HEIGHT) >> 15));
+        overview_bottom[x] = (uint8_t)(OVERVIEW_CENTER - ((lo * OVERVIEW_HALF_HEIGHT) >> 15));
+    }
+}
+
+// Played part in purple, the rest in teal, playhead in white
+static void draw_overview(void) {
+    int pitch = disp->stride / 2;
+    uint16_t *pixels = (uint16_t *)disp->buffer;
+    int playhead = music_track.length ? (int)((int64_t)music_track.position * OVERVIEW_WIDTH / music_track.length) : 0;
+    
+    for (int x = 0; x < OVERVIEW_WIDTH; x++) {
+        uint16_t color = x < playhead ? COLOR_PURPLE : COLOR_TEAL;
+        uint16_t *p = &pixels[overview_top[x] * pitch + OVERVIEW_X + x];
+        for (int y = overview_top[x]; y <= overview_bottom[x]; y++) {
+            *p = color;
+            p += pitch;
+        }
+    }
+    
+    graphics_draw_line(disp, OVERVIEW_X + playhead, OVERVIEW_CENTER - OVERVIEW_HALF_HEIGHT,
+                       OVERVIEW_X + playhead, OVERVIEW_CENTER + OVERVIEW_HALF_HEIGHT, COLOR_WHITE);
+}
+
+// Render size per mode; modes drawn at screen size only stay at RENDER_FULL
+static void set_mode_resolution(int mode, render_res_t resolution) {
+    if (resolution < RENDER_FULL || resolution >= RENDER_RES_COUNT) resolution = RENDER_FULL;
+    if (resolution > modes[mode]->lowest) resolution = modes[mode]->lowest;
+    
+    if (resolution != RENDER_FULL) lowres_init();
+    mode_resolution[mode] = resolution;
+}
+
+// Initialize the visualizer
+void init_visualizer(void) {
+    // Initialize visualization data
+    memset(channel_data, 0, sizeof(channel_data));
+    memset(frequency_data, 0, sizeof(frequency_data));
+    visualizer_state.avg_intensity = 0.0f;
+    frame_counter = 0;
+    seek_pending = 0;
+    beat_init(&beat_tracker, (float)AUDIO_SAMPLE_RATE / BUFFER_SIZE);
+    history_init(&band_history);
+    governor_init(&governor);
+    hud_init();
+    visualizer_state.quality = QUALITY_FULL;
+    
+    // Every mode's state is allocated up front so switching never allocates
+    for (int m = 0; m < VISUALIZER_MODE_COUNT; m++) {
+        modes[m]->init(&visualizer_state);
+    }
+    visualizer_set_mode(visualizer_mode);
+    visualizer_set_feedback(FEEDBACK_ENABLED);
+    visualizer_set_bloom(BLOOM_ENABLED);
+    for (int m = 0; m < VISUALIZER_MODE_COUNT; m++) {
+        set_mode_resolution(m, (render_res_t)RENDER_RESOLUTION);
+    }
+    
+    // Initialize audio track with embedded data
+    music_track.samples = (int16_t*)intensidade_audio;
+    music_track.length = AUDIO_LENGTH;
+    music_track.position = 0;
+    music_track.playing = 1;  // Start playing immediately
+    music_track.sample_rate = AUDIO_TRACK_SAMPLE_RATE;
+    music_track.channels = AUDIO_CHANNELS;
+    build_overview();
+    
+    #if DEBUG_ENABLED
+    debugf("Visualizer initialized\n");
+    debugf("- Bars: %d\n", NUM_BARS);
+    debugf("- Screen: %dx%d\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    debugf("- Max height: %d\n", MAX_BAR_HEIGHT);
+    debugf("- Audio length: %d samples\n", music_track.length);
+    debugf("- Audio duration: %d ms\n", AUDIO_DURATION_MS);
+    debugf("- Audio channels: %d\n", AUDIO_CHANNELS);
+    debugf("- Audio rate: %d Hz (analyzed at %d Hz)\n", AUDIO_TRACK_SAMPLE_RATE,
+           AUDIO_TRACK_SAMPLE_RATE / audio_track_ratio(&music_track));
+    #endif
+}
+
+// Process audio data and update visualization
+void process_audio(void) {
+    // This frame's samples, for modes that draw the waveform
+    if (music_track.playing && music_track.samples) {
+        int frames = BUFFER_SIZE * audio_track_ratio(&music_track);
+        sample_view_from_track(&visualizer_state.samples, &music_track, music_track.position, frames);
+        visualizer_state.sample_stride = music_track.channels == 2 ? 2 : 1;
+    }
+    
+    // Get frequency data from real audio, per channel
+    audio_update_stereo(&music_track, channel_data[0], channel_data[1]);
+    float sum = 0.0f;
+    for (int i = 0; i < NUM_FREQUENCY_BINS; i++) {
+        frequency_data[i] = 0.5f * (channel_data[0][i] + channel_data[1][i]);
+        sum += frequency_data[i];
+    }
+    visualizer_state.avg_intensity = sum / NUM_FREQUENCY_BINS;
+    beat_update(&beat_tracker, frequency_data);
+    history_push(&band_history, frequency_data);
+    
+    // Only the active mode advances
+    if (seek_pending) {
+        if (modes[visualizer_mode]->seek) modes[visualizer_mode]->seek(&visualizer_state);
+        seek_pending = 0;
+    }
+    modes[visualizer_mode]->update(&visualizer_state);
+}
+
+// Jump playback and analysis to `position` (track frames, wrapped). The
+// next frame is analyzed at the new spot and the active mode warm-starts
+// from it; the track overview is unaffected.
+void visualizer_seek(int position) {
+    audio_seek(&music_track, position);
+    beat_seek(&beat_tracker);
+    seek_pending = 1;
+}
+
+// Persistence trails on or off; the surfaces are allocated on first use
+void visualizer_set_feedback(int enabled) {
+    if (enabled) feedback_init();
+    feedback_enabled = enabled ? 1 : 0;
+    visualizer_state.feedback = feedback_enabled;
+}
+
+int visualizer_get_feedback(void) {
+    return feedback_enabled;
+}
+
+// Bloom on or off; the reduction surfaces are allocated on first use
+void visualizer_set_bloom(int enabled) {
+    if (enabled) bloom_init();
+    bloom_enabled = enabled ? 1 : 0;
+    visualizer_state.bloom = bloom_enabled;
+}
+
+int visualizer_get_bloom(void) {
+    return bloom_enabled;
+}
+
+// Effects actually drawn this frame: the user's settings, minus what the
+// quality level sheds. Trails coming back start from black, not from
+// whatever they held when they were shed.
+static void apply_quality(void) {
+    int feedback = feedback_enabled && visualizer_state.quality < QUALITY_NO_FEEDBACK;
+    if (feedback && !visualizer_state.feedback) feedback_init();
+    visualizer_state.feedback = feedback;
+    visualizer_state.bloom = bloom_enabled && visualizer_state.quality < QUALITY_NO_BLOOM;
+}
+
+// Render size for the active mode
+void visualizer_set_resolution(render_res_t resolution) {
+    set_mode_resolution(visualizer_mode, resolution);
+}
+
+render_res_t visualizer_get_resolution(void) {
+    return mode_resolution[visualizer_mode];
+}
+
+// Runtime quality governor on or off; off restores full quality
+void visualizer_set_governor(int enabled) {
+    governor_enabled = enabled;
+    governor_init(&governor);
+    visualizer_state.quality = QUALITY_FULL;
+}
+
+quality_level_t visualizer_quality(void) {
+    return visualizer_state.quality;
+}
+
+int visualizer_position(void) {
+    return music_track.position;
+}
+
+// Switch the main view; the new mode catches up from the shared state
+void visualizer_set_mode(visualizer_mode_t mode) {
+    if (mode < 0 || mode >= VISUALIZER_MODE_COUNT) mode = VISUALIZER_BARS;
+    
+    if (modes[mode]->enter) {
+        modes[mode]->enter(&visualizer_state);
+    }
+    visualizer_mode = mode;
+    
+    #if DEBUG_ENABLED
+    debugf("Mode: %s\n", modes[mode]->name);
+    #endif
+}
+
+visualizer_mode_t visualizer_get_mode(void) {
+    return visualizer_mode;
+}
+
+// Controller: R / C-right cycles forward through the modes, L / C-left back.
+// D-pad left/right jumps SEEK_STEP_MS, holding Z with it scrubs at
+// SCRUB_SPEED, Start goes back to the beginning. B toggles the trails,
+// A the bloom; C-down lowers the active mode's render size, C-up raises it.
+void visualizer_handle_input(joypad_buttons_t pressed, joypad_buttons_t held) {
+    int step = 0;
+    if (pressed.r || pressed.c_right) step = 1;
+    if (pressed.l || pressed.c_left) step = VISUALIZER_MODE_COUNT - 1;
+    
+    if (step) {
+        visualizer_set_mode((visualizer_mode_t)((visualizer_mode + step) % VISUALIZER_MODE_COUNT));
+    }
+    if (pressed.b) {
+        visualizer_set_feedback(!feedback_enabled);
+    }
+    if (pressed.a) {
+        visualizer_set_bloom(!bloom_enabled);
+    }
+    if (pressed.c_down && mode_resolution[visualizer_mode] + 1 < RENDER_RES_COUNT) {
+        visualizer_set_resolution(mode_resolution[visualizer_mode] + 1);
+    }
+    if (pressed.c_up && mode_resolution[visualizer_mode] > RENDER_FULL) {
+        visualizer_set_resolution(mode_resolution[visualizer_mode] - 1);
+    }
+    
+    // Playback already advances one frame's worth; scrubbing adds the rest
+    int frame = BUFFER_SIZE * audio_track_ratio(&music_track);
+    int jump = (int)((int64_t)SEEK_STEP_MS * AUDIO_TRACK_SAMPLE_RATE / 1000);
+    
+    if (held.z && (held.d_left || held.d_right)) {
+        // Only the position moves while scrubbing; the preroll, the beat
+        // tracker and the mode catch up with one seek on release
+        audio_set_position(&music_track, music_track.position + (held.d_right ? SCRUB_SPEED - 1 : -SCRUB_SPEED - 1) * frame);
+        scrubbing = 1;
+    } else if (scrubbing) {
+        visualizer_seek(music_track.position);
+        scrubbing = 0;
+    } else if (pressed.d_left || pressed.d_right) {
+        visualizer_seek(music_track.position + (pressed.d_right ? jump : -jump));
+    } else if (pressed.start) {
+        visualizer_seek(0);
+    }
+}
+
+// Render the visualizer
+void render_visualizer(surface_t *surface) {
+    disp = surface;
+    apply_quality();
+    
+    // With trails the mode draws over last frame's faded copy, offscreen;
+    // the HUD goes straight to the display so it doesn't smear. The trail
+    // surfaces are screen-sized, so a reduced render size applies without them
+    render_res_t resolution = mode_resolution[visualizer_mode];
+    if (visualizer_state.quality >= QUALITY_LOW_RES) {
+        resolution = modes[visualizer_mode]->lowest;
+    }
+    
+    surface_t *target = lowres_target(resolution);
+    if (visualizer_state.feedback) {
+        modes[visualizer_mode]->render(feedback_begin(), &visualizer_state);
+        feedback_present(disp);
+    } else if (target) {
+        modes[visualizer_mode]->render(target, &visualizer_state);
+        lowres_present(target, disp);
+    } else {
+        modes[visualizer_mode]->render(disp, &visualizer_state);
+    }
+    
+    // Bloom goes on the presented frame only, so it never feeds the trails
+    if (visualizer_state.bloom) {
+        bloom_apply(disp);
+    }
+    
+    // Show audio progress over the track's waveform
+    draw_overview();
+    
+    #if SHOW_FPS
+    // Frame counter, audio position and levels
+    float max_freq = 0.0f;
+    for (int i = 0; i < NUM_FREQUENCY_BINS; i++) {
+        if (frequency_data[i] > max_freq) max_freq = frequency_data[i];
+    }
+    hud_set_stats(frame_counter, music_track.position, music_track.length,
+                  max_freq, visualizer_state.avg_intensity, beat_tracker.bpm);
+    #endif
+    
+    // Title, track name and counters, from their cached textures
+    hud_draw(disp);
+}
+
+// Beat tracker state (tempo, phase, onsets) for renderers
+const beat_tracker_t *visualizer_beat(void) {
+    return &beat_tracker;
+}
+
+// Recent band frames (mid of both channels), newest first
+const band_history_t *visualizer_history(void) {
+    return &band_history;
+}
+
+// Run one full frame: analysis, physics and rendering
+void visualizer_frame(surface_t *surface) {
+    uint64_t start = platform_ticks();
+    
+    // Process audio and update visualization
+    process_audio();
+    
+    // Render
+    render_visualizer(surface);
+    
+    // The governor judges the work just done, not the wait for the display
+    if (governor_enabled) {
+        uint32_t frame_us = (uint32_t)platform_ticks_to_us(platform_ticks() - start);
+        visualizer_state.quality = governor_update(&governor, frame_us);
+    }
+    
+    // Update frame counter
+    frame_counter++;
+}
@@ -0,0 +1,39 @@
+#ifndef VISUALIZER_H
+#define VISUALIZER_H
+
+#include "platform.h"
+#include "beat.h"
+#include "history.h"
+#include "mode.h"
+
+// Main view; each has a descriptor in the registry in visualizer.c
+typedef enum {
+    VISUALIZER_BARS,            // Mirrored neon bars (left up, right down)
+    VISUALIZER_WATERFALL,       // Scrolling spectrogram of the band history
+    VISUALIZER_SCOPE,           // Triggered oscilloscope of the track waveform
+    VISUALIZER_RADIAL,          // Bands radiating from the screen center
+    VISUALIZER_MODE_COUNT
+} visualizer_mode_t;
+
+// Visualizer state and per-frame entry points
+void init_visualizer(void);
+void process_audio(void);
+void render_visualizer(surface_t *surface);
+void visualizer_frame(surface_t *surface);
+void visualizer_set_mode(visualizer_mode_t mode);
+visualizer_mode_t visualizer_get_mode(void);
+void visualizer_handle_input(joypad_buttons_t pressed, joypad_buttons_t held);
+void visualizer_seek(int position);
+void visualizer_set_feedback(int enabled);
+int visualizer_get_feedback(void);
+void visualizer_set_bloom(int enabled);
+int visualizer_get_bloom(void);
+void visualizer_set_resolution(render_res_t resolution);
+render_res_t visualizer_get_resolution(void);
+void visualizer_set_governor(int enabled);
+quality_level_t visualizer_quality(void);
+int visualizer_position(void);
+const beat_tracker_t *visualizer_beat(void);
+const band_history_t *visualizer_history(void);
+
+#endif // VISUALIZER_H
@@ -0,0 +1,122 @@
+#include "waterfall.h"
+#include "config.h"
+#include <string.h>
+
+#define WATERFALL_MASK          (WATERFALL_ROWS - 1)
+#define BAND_PIXELS             (SCREEN_WIDTH / NUM_FREQUENCY_BINS)
+
+static surface_t texture;
+static int newest_row = 0;
+
+// Level -> neon gradient: black, teal, purple, pink, white
+static uint16_t palette[256];
+
+static void build_palette(void) {
+    static const uint8_t stops[5][3] = {
+        {   0,   0,   0 },
+        {   0, 255, 255 },
+        { 128,   0, 255 },
+        { 255,   0, 255 },
+        { 255, 255, 255 },
+    };
+    
+    for (int i = 0; i < 256; i++) {
+        int segment = i * 4 / 256;
+        int t = i * 4 - segment * 256;          // 0..255 within the segment
+        const uint8_t *a = stops[segment];
+        const uint8_t *b = stops[segment + 1];
+        
+        palette[i] = color_to_packed16(RGBA32(a[0] + (b[0] - a[0]) * t / 256,
+                                              a[1] + (b[1] - a[1]) * t / 256,
+                                              a[2] + (b[2] - a[2]) * t / 256, 0xFF));
+    }
+}
+
+void waterfall_init(void) {
+    if (texture.buffer) return;
+    
+    texture = surface_alloc(FMT_RGBA16, SCREEN_WIDTH, WATERFALL_ROWS);
+    memset(texture.buffer, 0, (size_t)texture.stride * WATERFALL_ROWS);
+    build_palette();
+    newest_row = 0;
+}
+
+// Repaint every row from the history ring, e.g. when the mode is entered
+void waterfall_rebuild(const band_history_t *history) {
+    if (!texture.buffer) waterfall_init();
+    
+    memset(texture.buffer, 0, (size_t)texture.stride * WATERFALL_ROWS);
+    for (int age = history_length(history) - 1; age >= 0; age--) {
+        waterfall_push(history_frame(history, age));
+    }
+}
+
+// Paint one band frame as the new top row
+void waterfall_push(const uint8_t *frame) {
+    newest_row = (newest_row - 1) & WATERFALL_MASK;
+    uint16_t *row = (uint16_t *)((uint8_t *)texture.buffer + newest_row * texture.stride);
+    
+    for (int b = 0; b < NUM_FREQUENCY_BINS; b++) {
+        uint16_t color = palette[frame[b]];
+        for (int x = 0; x < BAND_PIXELS; x++) {
+            *row++ = color;
+        }
+    }
+}
+
+// Copy rows oldest-last to the screen starting at row y: the ring from the
+// newest row to its end, then its start up to the newest row
+void waterfall_draw(surface_t *surface, int y) {
+    int first = WATERFALL_ROWS - newest_row;
+    const uint8_t *src = texture.buffer;
+    uint8_t *dst = (uint8_t *)surface->buffer + y * surface->stride;
+    
+    if (surface->stride == texture.stride) {
+        memcpy(dst, src + newest_row * texture.stride, (size_t)first * texture.stride);
+        memcpy(dst + first * surface->stride, src, (size_t)newest_row * texture.stride);
+        return;
+    }
+    
+    // Mismatched pitch: same two spans, one row at a time
+    int bytes = texture.stride < surface->stride ? texture.stride : surface->stride;
+    for (int r = 0; r < WATERFALL_ROWS; r++) {
+        int ring_row = (newest_row + r) & WATERFALL_MASK;
+        memcpy(dst + r * surface->stride, src + ring_row * texture.stride, bytes);
+    }
+}
+
+static void waterfall_mode_init(const visualizer_state_t *state) {
+    (void)state;
+    waterfall_init();
+}
+
+// Entering the mode repaints the texture from the history ring
+static void waterfall_enter(const visualizer_state_t *state) {
+    waterfall_rebuild(state->history);
+}
+
+// One new row; the rest of the image scrolls by ring offset
+static void waterfall_update(const visualizer_state_t *state) {
+    waterfall_push(history_frame(state->history, 0));
+}
+
+// Clear only what the spectrogram doesn't cover, then present the ring
+static void waterfall_render(surface_t *surface, const visualizer_state_t *state) {
+    int bottom = WATERFALL_Y + WATERFALL_ROWS;
+    
+    if (!state->feedback) {
+        graphics_draw_box(surface, 0, 0, SCREEN_WIDTH, WATERFALL_Y, COLOR_BLACK);
+        graphics_draw_box(surface, 0, bottom, SCREEN_WIDTH, SCREEN_HEIGHT - bottom, COLOR_BLACK);
+    }
+    waterfall_draw(surface, WATERFALL_Y);
+}
+
+const visualizer_mode_desc_t waterfall_mode = {
+    "waterfall",
+    waterfall_mode_init,
+    waterfall_enter,
+    NULL,
+    waterfall_update,
+    waterfall_render,
+    RENDER_FULL,
+};
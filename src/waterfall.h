@@ -0,0 +1,29 @@
+#ifndef WATERFALL_H
+#define WATERFALL_H
+
+#include "platform.h"
+#include "history.h"
+#include "mode.h"
+
+// =============================================================================
+// Scrolling spectrogram (waterfall)
+//
+// The image lives in an offscreen RGBA5551 texture used as a ring of rows:
+// each frame writes only the newest row, one step "above" the previous one,
+// and presenting copies the ring to the screen in two spans starting at the
+// newest row. Scrolling is just the moving ring offset; history is never
+// redrawn.
+// =============================================================================
+
+#define WATERFALL_ROWS          HISTORY_FRAMES
+#define WATERFALL_Y             40      // Screen row of the newest band frame
+
+extern const visualizer_mode_desc_t waterfall_mode;
+
+// Function prototypes
+void waterfall_init(void);
+void waterfall_rebuild(const band_history_t *history);
+void waterfall_push(const uint8_t *frame);
+void waterfall_draw(surface_t *surface, int y);
+
+#endif // WATERFALL_H
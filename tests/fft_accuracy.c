@@ -0,0 +1,330 @@
+#include "platform.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "config.h"
+#include "audio.h"
+#include "filterbank.h"
+#include TRACK_HEADER
+
+// =============================================================================
+// Spectrum accuracy harness (make host-test)
+//
+// Feeds sine sweeps, impulses, white noise and excerpts of intensidade_audio
+// through every spectrum engine below, with every analysis window, and
+// compares the magnitudes against a double-precision naive DFT, per FFT bin
+// and per fft_to_frequency_bins band (under every filterbank layout).
+// An engine fails when its worst error exceeds its budget.
+//
+// Usage: fft-accuracy [-v]     (-v also prints the per-bin table)
+// =============================================================================
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define NUM_SPECTRUM_BINS   (FFT_SIZE / 2)
+
+// Errors are normalized to the magnitude of a full-scale sine (FFT_SIZE / 2)
+#define FULL_SCALE          (FFT_SIZE / 2.0)
+
+typedef struct {
+    const char *name;
+    // FFT_SIZE int16 samples in, NUM_SPECTRUM_BINS magnitudes out
+    void (*compute)(const int16_t *samples, float *magnitudes);
+    double bin_budget;          // Max normalized bin error
+    double band_budget;         // Max band error (fft_to_frequency_bins units)
+} spectrum_engine_t;
+
+static void engine_fft_compute(const int16_t *samples, float *magnitudes) {
+    fft_compute((int16_t *)samples, magnitudes, FFT_SIZE);
+}
+
+// Split the window across both segments of a view to exercise the wrap path
+static void engine_fft_compute_view(const int16_t *samples, float *magnitudes) {
+    sample_view_t view = { samples, 200, samples + 200, FFT_SIZE - 200 };
+    fft_compute_view(&view, magnitudes);
+}
+
+// Packed stereo: the signal rides on one channel next to an unrelated one
+// (its time reverse) on the other, so any leakage between them shows up
+static void engine_stereo(const int16_t *samples, float *magnitudes, int channel) {
+    static int16_t other[FFT_SIZE];
+    static float discard[NUM_SPECTRUM_BINS];
+    sample_view_t signal, partner;
+    
+    for (int n = 0; n < FFT_SIZE; n++) {
+        other[n] = samples[FFT_SIZE - 1 - n];
+    }
+    sample_view_from_buffer(&signal, samples, FFT_SIZE);
+    sample_view_from_buffer(&partner, other, FFT_SIZE);
+    
+    if (channel == 0) {
+        fft_compute_stereo(&signal, &partner, magnitudes, discard);
+    } else {
+        fft_compute_stereo(&partner, &signal, discard, magnitudes);
+    }
+}
+
+static void engine_fft_compute_stereo_left(const int16_t *samples, float *magnitudes) {
+    engine_stereo(samples, magnitudes, 0);
+}
+
+static void engine_fft_compute_stereo_right(const int16_t *samples, float *magnitudes) {
+    engine_stereo(samples, magnitudes, 1);
+}
+
+// Welch batch over four copies of the same (wrapped) window: averaging
+// identical power spectra must give back the plain magnitudes
+static void engine_fft_compute_batch(const int16_t *samples, float *magnitudes) {
+    sample_view_t view = { samples, 300, samples + 300, FFT_SIZE - 300 };
+    fft_compute_batch(&view, 0, 4, magnitudes);
+}
+
+static const spectrum_engine_t engines[] = {
+    { "fft_compute",            engine_fft_compute,         1e-4, 1e-3 },
+    { "fft_compute_view",       engine_fft_compute_view,    1e-4, 1e-3 },
+    { "fft_compute_batch",      engine_fft_compute_batch,   1e-4, 1e-3 },
+    { "fft_compute_stereo/L",   engine_fft_compute_stereo_left,  1e-4, 1e-3 },
+    { "fft_compute_stereo/R",   engine_fft_compute_stereo_right, 1e-4, 1e-3 },
+};
+
+#define NUM_ENGINES ((int)(sizeof(engines) / sizeof(engines[0])))
+
+// Test signal classes
+enum {
+    SIGNAL_SWEEP,
+    SIGNAL_IMPULSE,
+    SIGNAL_NOISE,
+    SIGNAL_TRACK,
+    NUM_SIGNALS
+};
+
+static const char *signal_names[NUM_SIGNALS] = { "sine sweep", "impulses", "white noise", "track excerpts" };
+
+#define SWEEP_FRAMES        48
+#define IMPULSE_FRAMES      6
+#define NOISE_FRAMES        16
+#define TRACK_FRAMES        32
+
+typedef struct {
+    double max;
+    double sum_sq;
+    long count;
+    int worst;
+} error_stats_t;
+
+static const char *window_names[FFT_WINDOW_COUNT] = { "rectangular", "hann", "blackman" };
+
+static double ref_cos[FFT_SIZE];
+static double ref_sin[FFT_SIZE];
+static double ref_window[FFT_SIZE];
+static uint32_t noise_seed = 0x2545F491;
+
+static void stats_add(error_stats_t *s, double err, int index) {
+    err = fabs(err);
+    if (err > s->max || s->count == 0) {
+        s->max = err;
+        s->worst = index;
+    }
+    s->sum_sq += err * err;
+    s->count++;
+}
+
+static double stats_rms(const error_stats_t *s) {
+    return s->count ? sqrt(s->sum_sq / s->count) : 0.0;
+}
+
+static void reference_dft(const int16_t *samples, double *magnitudes) {
+    for (int k = 0; k < NUM_SPECTRUM_BINS; k++) {
+        double re = 0.0, im = 0.0;
+        for (int n = 0; n < FFT_SIZE; n++) {
+            int w = (k * n) % FFT_SIZE;
+            double x = samples[n] / 32768.0 * ref_window[n];
+            re += x * ref_cos[w];
+            im += x * ref_sin[w];
+        }
+        magnitudes[k] = sqrt(re * re + im * im);
+    }
+}
+
+// Same sparse weights as the active filterbank layout, with an exact log
+static void reference_bands(const double *magnitudes, double *bands) {
+    const filterbank_band_t *table = filterbank_bands();
+    const int16_t *weights = filterbank_weights();
+    
+    for (int i = 0; i < NUM_FREQUENCY_BINS; i++) {
+        double sum = 0.0;
+        for (int j = 0; j < table[i].length; j++) {
+            sum += magnitudes[table[i].start + j] * weights[table[i].offset + j];
+        }
+        bands[i] = log(1.0 + sum / 32768.0 * 10.0);
+    }
+}
+
+// Window normalized to unit mean, matching fft_set_window
+static void reference_window(fft_window_t window) {
+    double sum = 0.0;
+    for (int n = 0; n < FFT_SIZE; n++) {
+        double x = 2.0 * M_PI * n / FFT_SIZE;
+        switch (window) {
+            case FFT_WINDOW_HANN:     ref_window[n] = 0.5 - 0.5 * cos(x); break;
+            case FFT_WINDOW_BLACKMAN: ref_window[n] = 0.42 - 0.5 * cos(x) + 0.08 * cos(2.0 * x); break;
+            default:                  ref_window[n] = 1.0; break;
+        }
+        sum += ref_window[n];
+    }
+    for (int n = 0; n < FFT_SIZE; n++) {
+        ref_window[n] *= FFT_SIZE / sum;
+    }
+}
+
+static int signal_frames(int signal) {
+    switch (signal) {
+        case SIGNAL_SWEEP:   return SWEEP_FRAMES;
+        case SIGNAL_IMPULSE: return IMPULSE_FRAMES;
+        case SIGNAL_NOISE:   return NOISE_FRAMES;
+        default:             return TRACK_FRAMES;
+    }
+}
+
+static void generate_signal(int signal, int frame, int16_t *out) {
+    switch (signal) {
+        case SIGNAL_SWEEP: {
+            // Log-spaced tones from 20 Hz to just below Nyquist, off-bin
+            double f = 20.0 * pow((AUDIO_SAMPLE_RATE / 2.0 - 100.0) / 20.0, (double)frame / (SWEEP_FRAMES - 1));
+            for (int n = 0; n < FFT_SIZE; n++) {
+                out[n] = (int16_t)lrint(16384.0 * sin(2.0 * M_PI * f * n / AUDIO_SAMPLE_RATE));
+            }
+            break;
+        }
+        case SIGNAL_IMPULSE: {
+            static const int positions[IMPULSE_FRAMES] = { 0, 1, 17, FFT_SIZE / 2, FFT_SIZE - 2, FFT_SIZE - 1 };
+            memset(out, 0, FFT_SIZE * sizeof(int16_t));
+            out[positions[frame]] = 32767;
+            break;
+        }
+        case SIGNAL_NOISE:
+            for (int n = 0; n < FFT_SIZE; n++) {
+                noise_seed = noise_seed * 1664525u + 1013904223u;
+                out[n] = (int16_t)(noise_seed >> 16);
+            }
+            break;
+        default: {
+            int offset = (int)((long)(AUDIO_LENGTH - FFT_SIZE) * frame / TRACK_FRAMES);
+            memcpy(out, &intensidade_audio[offset * AUDIO_CHANNELS], FFT_SIZE * sizeof(int16_t));
+            break;
+        }
+    }
+}
+
+static int run_engine(const spectrum_engine_t *engine, int verbose) {
+    static int16_t samples[FFT_SIZE];
+    static float magnitudes[NUM_SPECTRUM_BINS];
+    static float bands[NUM_FREQUENCY_BINS];
+    static double ref_magnitudes[NUM_SPECTRUM_BINS];
+    static double ref_bands[NUM_FREQUENCY_BINS];
+    static error_stats_t per_bin[NUM_SPECTRUM_BINS];
+    static error_stats_t per_band[NUM_FREQUENCY_BINS];
+    
+    error_stats_t bin_total, band_total;
+    memset(per_bin, 0, sizeof(per_bin));
+    memset(per_band, 0, sizeof(per_band));
+    memset(&band_total, 0, sizeof(band_total));
+    
+    printf("== %s (%s window) ==\n", engine->name, window_names[fft_get_window()]);
+    printf("%-16s %12s %12s %8s %12s %12s\n", "signal", "bin max", "bin rms", "worst", "band max", "band rms");
+    
+    double worst_bin = 0.0;
+    double worst_band = 0.0;
+    
+    for (int signal = 0; signal < NUM_SIGNALS; signal++) {
+        memset(&bin_total, 0, sizeof(bin_total));
+        memset(&band_total, 0, sizeof(band_total));
+        noise_seed = 0x2545F491;
+        
+        for (int frame = 0; frame < signal_frames(signal); frame++) {
+            generate_signal(signal, frame, samples);
+            
+            engine->compute(samples, magnitudes);
+            reference_dft(samples, ref_magnitudes);
+            
+            for (int k = 0; k < NUM_SPECTRUM_BINS; k++) {
+                double err = (magnitudes[k] - ref_magnitudes[k]) / FULL_SCALE;
+                stats_add(&per_bin[k], err, k);
+                stats_add(&bin_total, err, k);
+            }
+            
+            for (int layout = 0; layout < FILTERBANK_LAYOUT_COUNT; layout++) {
+                filterbank_set_layout((filterbank_layout_t)layout);
+                fft_to_frequency_bins(magnitudes, bands, FFT_SIZE, NUM_FREQUENCY_BINS);
+                reference_bands(ref_magnitudes, ref_bands);
+                
+                for (int b = 0; b < NUM_FREQUENCY_BINS; b++) {
+                    double err = bands[b] - ref_bands[b];
+                    stats_add(&per_band[b], err, b);
+                    stats_add(&band_total, err, b);
+                }
+            }
+        }
+        
+        printf("%-16s %12.3e %12.3e %8d %12.3e %12.3e\n", signal_names[signal],
+               bin_total.max, stats_rms(&bin_total), bin_total.worst,
+               band_total.max, stats_rms(&band_total));
+        
+        if (bin_total.max > worst_bin) worst_bin = bin_total.max;
+        if (band_total.max > worst_band) worst_band = band_total.max;
+    }
+    
+    printf("\n%-6s %12s %12s\n", "band", "max", "rms");
+    for (int b = 0; b < NUM_FREQUENCY_BINS; b++) {
+        printf("%-6d %12.3e %12.3e\n", b, per_band[b].max, stats_rms(&per_band[b]));
+    }
+    
+    if (verbose) {
+        printf("\n%-6s %12s %12s\n", "bin", "max", "rms");
+        for (int k = 0; k < NUM_SPECTRUM_BINS; k++) {
+            printf("%-6d %12.3e %12.3e\n", k, per_bin[k].max, stats_rms(&per_bin[k]));
+        }
+    }
+    
+    int ok = worst_bin <= engine->bin_budget && worst_band <= engine->band_budget;
+    printf("\n%s/%s: bin max %.3e (budget %.1e), band max %.3e (budget %.1e) -> %s\n\n",
+           engine->name, window_names[fft_get_window()], worst_bin, engine->bin_budget, worst_band, engine->band_budget,
+           ok ? "PASS" : "FAIL");
+    
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    int verbose = argc > 1 && strcmp(argv[1], "-v") == 0;
+    
+    for (int i = 0; i < FFT_SIZE; i++) {
+        ref_cos[i] = cos(-2.0 * M_PI * i / FFT_SIZE);
+        ref_sin[i] = sin(-2.0 * M_PI * i / FFT_SIZE);
+    }
+    
+    fft_init();
+    filterbank_layout_t layout = filterbank_get_layout();
+    
+    int failed = 0;
+    for (int w = 0; w < FFT_WINDOW_COUNT; w++) {
+        fft_set_window((fft_window_t)w);
+        reference_window((fft_window_t)w);
+        
+        for (int i = 0; i < NUM_ENGINES; i++) {
+            if (!run_engine(&engines[i], verbose)) failed++;
+        }
+    }
+    
+    filterbank_set_layout(layout);
+    
+    if (failed) {
+        printf("%d engine/window combination(s) over budget\n", failed);
+        return 1;
+    }
+    
+    printf("All %d engine(s) within budget for every window\n", NUM_ENGINES);
+    return 0;
+}
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+Benchmark Comparator
+Compara resultados de benchmark (JSON) com uma baseline e falha se algum
+kernel regrediu além do limite.
+
+Com vários resultados atuais usa a mediana de cada kernel entre eles. No
+host a máquina inteira oscila de uma execução para outra (todos os kernels
+±40% juntos), então por padrão a variação de cada kernel é medida contra a
+variação mediana de todos ("deriva"): o gate pega o kernel que ficou mais
+lento que o resto, não a máquina que ficou mais lenta. Só a deriva para
+mais lento é descontada: numa fase rápida nem todos os kernels aceleram
+igual, e um kernel mais rápido que a baseline não é regressão.
+
+Acima de --threshold o kernel regrediu, a não ser que a variação caiba no
+ruído medido na baseline ("spread" de bench_median.py): aí vira só aviso.
+Essa margem nunca passa do próprio --threshold, então um kernel ruidoso
+falha no máximo a 2x o limite, nunca passa calado.
+"""
+
+import json
+import sys
+import argparse
+import statistics
+
+
+def load_results(path):
+    with open(path) as f:
+        return json.load(f)
+
+
+def median_kernels(runs, metric):
+    """
+    Mediana de `metric` por kernel entre as execuções
+    """
+    kernels = {}
+    for name in runs[0].get("kernels", {}):
+        values = [run["kernels"][name][metric] for run in runs if name in run.get("kernels", {})]
+        kernels[name] = statistics.median(values)
+    return kernels
+
+
+def drift(base_kernels, cur_kernels, metric):
+    """
+    Razão mediana atual/baseline entre os kernels presentes nos dois
+    """
+    ratios = [cur_kernels[name] / base[metric] for name, base in base_kernels.items()
+              if name in cur_kernels and base[metric] > 0]
+    return statistics.median(ratios) if ratios else 1.0
+
+
+def compare(baseline, cur_kernels, metric, threshold, scale=1.0):
+    """
+    Retorna a lista de (kernel, base, atual, variação, status); a variação é
+    relativa à deriva `scale` da máquina. Entre `threshold` e `threshold`
+    mais o ruído medido do kernel (limitado a `threshold`) o status é
+    "noise?", um aviso que não falha
+    """
+    rows = []
+    base_kernels = baseline.get("kernels", {})
+
+    for name, base in base_kernels.items():
+        if name not in cur_kernels:
+            rows.append((name, base[metric], None, None, "MISSING"))
+            continue
+
+        cur = cur_kernels[name]
+        change = cur / (base[metric] * scale) - 1.0 if base[metric] > 0 else 0.0
+        noise = min(base.get("spread", {}).get(metric, 0.0), threshold)
+        if change > threshold + noise:
+            status = "REGRESSION"
+        elif change > threshold:
+            status = "noise?"
+        else:
+            status = "ok"
+        rows.append((name, base[metric], cur, change, status))
+
+    for name, cur in cur_kernels.items():
+        if name not in base_kernels:
+            rows.append((name, None, cur, None, "NEW"))
+
+    return rows
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare benchmark results against a baseline")
+    parser.add_argument("baseline", help="baseline JSON (e.g. bench/baselines/host.json)")
+    parser.add_argument("current", nargs="+", help="current results JSON, one per run (median is compared)")
+    parser.add_argument("--metric", default="p50", choices=["min", "p50", "p90", "p99", "mean"],
+                        help="statistic to compare (default: p50)")
+    parser.add_argument("--threshold", type=float, default=0.15,
+                        help="allowed slowdown as a fraction (default: 0.15 = 15%%); up to as "
+                             "much again is only a warning when the kernel's measured spread covers it")
+    parser.add_argument("--no-drift", action="store_true",
+                        help="compare raw times, without factoring out the machine-wide drift")
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    runs = [load_results(path) for path in args.current]
+    current = runs[0]
+    cur_kernels = median_kernels(runs, args.metric)
+
+    if baseline.get("platform") != current.get("platform"):
+        print(f"⚠️  Plataformas diferentes: baseline={baseline.get('platform')} "
+              f"atual={current.get('platform')}")
+
+    scale = 1.0
+    if not args.no_drift:
+        machine = drift(baseline.get("kernels", {}), cur_kernels, args.metric)
+        print(f"Deriva da máquina (mediana de todos os kernels): {(machine - 1.0) * 100:+.1f}%"
+              f"{'' if machine > 1.0 else ' (mais rápida, não descontada)'}")
+        scale = max(machine, 1.0)
+
+    rows = compare(baseline, cur_kernels, args.metric, args.threshold, scale)
+
+    print(f"{'kernel':<28} {'baseline':>12} {'atual':>12} {'variação':>9}  status")
+    for name, base, cur, change, status in rows:
+        base_s = f"{base:.1f}" if base is not None else "-"
+        cur_s = f"{cur:.1f}" if cur is not None else "-"
+        change_s = f"{change * 100:+.1f}%" if change is not None else "-"
+        print(f"{name:<28} {base_s:>12} {cur_s:>12} {change_s:>9}  {status}")
+
+    warned = [r for r in rows if r[4] == "noise?"]
+    if warned:
+        print(f"\n⚠️  {len(warned)} kernel(s) acima de {args.threshold * 100:.0f}%, mas dentro do "
+              f"ruído medido: {', '.join(r[0] for r in warned)}")
+
+    failed = [r for r in rows if r[4] in ("REGRESSION", "MISSING")]
+    if failed:
+        print(f"\n❌ {len(failed)} kernel(s) regrediram mais de {args.threshold * 100:.0f}% "
+              f"({args.metric}) além do ruído medido ou sumiram")
+        sys.exit(1)
+
+    print(f"\n✅ Nenhuma regressão acima de {args.threshold * 100:.0f}% ({args.metric})")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""
+Benchmark Log Converter
+Converte o log "BENCH ..." da ROM de benchmark (capturado via ISViewer/USB
+num emulador ou no ED64) para o JSON usado por bench_compare.py
+"""
+
+import json
+import sys
+
+
+def parse_fields(line):
+    fields = {}
+    for token in line.split()[1:]:
+        if "=" in token:
+            key, value = token.split("=", 1)
+            fields[key] = value
+    return fields
+
+
+def parse_log(lines):
+    header = None
+    kernels = {}
+
+    for line in lines:
+        # O log pode ter prefixos do emulador; procura o marcador
+        pos = line.find("BENCH")
+        if pos < 0:
+            continue
+        line = line[pos:].strip()
+
+        if line.startswith("BENCH_BEGIN"):
+            header = parse_fields(line)
+            kernels = {}
+        elif line.startswith("BENCH "):
+            f = parse_fields(line)
+            entry = {"calls": int(f["calls"])}
+            for key in ("min", "p50", "p90", "p99", "max", "mean"):
+                entry[key] = float(f[key])
+            if int(f.get("pixels", 0)) > 0:
+                entry["pixels"] = int(f["pixels"])
+                entry["p50_per_pixel"] = float(f["p50"]) / int(f["pixels"])
+            kernels[f["name"]] = entry
+        elif line.startswith("BENCH_END") and header is not None:
+            return header, kernels
+
+    if header is None:
+        raise ValueError("nenhum bloco BENCH_BEGIN/BENCH_END encontrado")
+    raise ValueError("log truncado: BENCH_END não encontrado")
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("Uso: python3 bench_log_to_json.py <log.txt> [saida.json]")
+        sys.exit(1)
+
+    with open(sys.argv[1], errors="replace") as f:
+        header, kernels = parse_log(f)
+
+    result = {
+        "platform": header.get("platform", "unknown"),
+        "unit": header.get("unit", "cycles") + "/call",
+        "warmup": int(header.get("warmup", 0)),
+        "samples": int(header.get("samples", 0)),
+        "kernels": kernels,
+    }
+
+    text = json.dumps(result, indent=2) + "\n"
+    if len(sys.argv) > 2:
+        with open(sys.argv[2], "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
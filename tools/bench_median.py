@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""
+Benchmark Median
+Junta vários resultados de benchmark (JSON) do mesmo binário num só, com a
+mediana de cada estatística por kernel. Uma execução isolada no host oscila
+demais (frequência da CPU, outros processos) para servir de baseline.
+
+Cada kernel também guarda "spread": a dispersão robusta de cada estatística
+entre as execuções, 1.4826 * MAD / mediana (equivale ao desvio padrão
+relativo para ruído normal, mas uma execução discrepante não o infla).
+bench_compare.py usa esse ruído medido, limitado, para separar regressões de
+avisos dentro do ruído
+
+Com --append, acrescenta a uma baseline existente só os kernels que ela
+ainda não tem; os já gravados não são medidos de novo
+"""
+
+import json
+import sys
+import statistics
+
+STATS = ("min", "p50", "p90", "p99", "max", "mean")
+
+
+def run_drift(run, medians, key):
+    """
+    Quanto esta execução inteira ficou acima/abaixo das medianas
+    """
+    ratios = [run["kernels"][name][key] / median for name, median in medians.items()
+              if name in run["kernels"] and median > 0]
+    return statistics.median(ratios) if ratios else 1.0
+
+
+def robust_spread(values):
+    """
+    1.4826 * MAD / mediana: desvio padrão relativo estimado sem deixar uma
+    execução discrepante dominar, como faria (máx - mín)
+    """
+    center = statistics.median(values)
+    if center <= 0:
+        return 0.0
+    mad = statistics.median(abs(v - center) for v in values)
+    return 1.4826 * mad / center
+
+
+def merge(runs):
+    merged = dict(runs[0])
+    merged["runs"] = len(runs)
+    merged["kernels"] = {}
+
+    names = list(runs[0]["kernels"])
+    for key in STATS:
+        medians = {name: statistics.median(run["kernels"][name][key] for run in runs if name in run["kernels"])
+                   for name in names}
+        drifts = [run_drift(run, medians, key) for run in runs]
+
+        for name in names:
+            entry = merged["kernels"].setdefault(name, dict(runs[0]["kernels"][name], spread={}))
+            entry[key] = round(medians[name], 1)
+
+            # Dispersion of the per-run values, with each run's machine-wide
+            # drift factored out like bench_compare.py does for the comparison
+            values = [run["kernels"][name][key] / drift for run, drift in zip(runs, drifts)
+                      if name in run["kernels"]]
+            entry["spread"][key] = round(robust_spread(values), 3)
+
+    return merged
+
+
+def append(baseline, result):
+    """
+    Kernels novos de result entram no fim da baseline; os existentes ficam
+    como estão, para que só uma re-baseline explícita os altere
+    """
+    added = [name for name in result["kernels"] if name not in baseline["kernels"]]
+    for name in added:
+        baseline["kernels"][name] = result["kernels"][name]
+    return added
+
+
+def dump(merged):
+    """
+    Uma linha por kernel, como o JSON do bench-host, para que a baseline
+    mude só nas linhas dos kernels que mudaram
+    """
+    lines = ["{"]
+    for key, value in merged.items():
+        if key != "kernels":
+            lines.append(f"  {json.dumps(key)}: {json.dumps(value)},")
+    lines.append('  "kernels": {')
+    names = list(merged["kernels"])
+    for i, name in enumerate(names):
+        comma = "," if i + 1 < len(names) else ""
+        lines.append(f"    {json.dumps(name)}: {json.dumps(merged['kernels'][name])}{comma}")
+    lines.append("  }")
+    lines.append("}")
+    return "\n".join(lines)
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("Uso: python3 bench_median.py <run1.json> [run2.json ...] > mediana.json")
+        print("     python3 bench_median.py --append <baseline.json> <mediana.json>")
+        sys.exit(1)
+
+    if sys.argv[1] == "--append":
+        if len(sys.argv) != 4:
+            print("Uso: python3 bench_median.py --append <baseline.json> <mediana.json>")
+            sys.exit(1)
+        with open(sys.argv[2]) as f:
+            baseline = json.load(f)
+        with open(sys.argv[3]) as f:
+            result = json.load(f)
+
+        added = append(baseline, result)
+        with open(sys.argv[2], "w") as f:
+            f.write(dump(baseline) + "\n")
+        print(f"{len(added)} kernel(s) novo(s) na baseline: {', '.join(added) or 'nenhum'}")
+        return
+
+    runs = []
+    for path in sys.argv[1:]:
+        with open(path) as f:
+            runs.append(json.load(f))
+
+    print(dump(merge(runs)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Decimator Generator
+Projeta os filtros anti-aliasing (FIR de fase linear, janela de Kaiser) dos
+decimadores polifásicos 2x e 4x e gera os coeficientes Q15
+"""
+
+import argparse
+import math
+import os
+
+
+def bessel_i0(x):
+    total = term = 1.0
+    for k in range(1, 40):
+        term *= (x / (2.0 * k)) ** 2
+        total += term
+    return total
+
+
+def design(ratio, taps, beta, cutoff):
+    """
+    Sinc janelado com corte em cutoff * (fs_saida / 2), ganho DC 1
+    """
+    fc = cutoff * 0.5 / ratio
+    h = []
+    for n in range(taps):
+        m = n - (taps - 1) / 2.0
+        s = 2.0 * fc if m == 0 else math.sin(2.0 * math.pi * fc * m) / (math.pi * m)
+        w = bessel_i0(beta * math.sqrt(max(0.0, 1.0 - (2.0 * n / (taps - 1) - 1.0) ** 2))) / bessel_i0(beta)
+        h.append(s * w)
+    total = sum(h)
+    return [c / total for c in h]
+
+
+def to_q15(h):
+    """
+    Quantiza mantendo a soma em 32768 (ganho DC exato) e a simetria
+    """
+    q = [int(round(c * 32768.0)) for c in h]
+    error = 32768 - sum(q)
+    center = len(q) // 2
+    # Corrige nos taps centrais, aos pares para não quebrar a simetria
+    i = 0
+    while error != 0:
+        step = 1 if error > 0 else -1
+        if len(q) % 2 and i == 0 and abs(error) % 2:
+            q[center] += step
+            error -= step
+        else:
+            q[center - 1 - i % 2] += step
+            q[len(q) - center + i % 2] += step
+            error -= 2 * step
+        i += 1
+    return q
+
+
+def response_db(h, f):
+    re = sum(c * math.cos(2.0 * math.pi * f * n) for n, c in enumerate(h))
+    im = sum(c * math.sin(2.0 * math.pi * f * n) for n, c in enumerate(h))
+    return 20.0 * math.log10(max(math.hypot(re, im), 1e-12))
+
+
+def generate(ratios, taps_per_phase, beta, cutoff, out_c, out_h):
+    tables = {}
+    for ratio in ratios:
+        taps = taps_per_phase * ratio
+        q = to_q15(design(ratio, taps, beta, cutoff))
+        tables[ratio] = q
+        h = [c / 32768.0 for c in q]
+        stop = max(response_db(h, f / 1000.0) for f in range(int(600 / ratio), 500))
+        passband = response_db(h, 0.35 / ratio)
+        print(f"   - {ratio}x: {taps} taps, {passband:.2f} dB em 0.35 fs_saida, "
+              f"rejeição {stop:.1f} dB acima de 0.6 fs_saida")
+
+    header = os.path.basename(out_h)
+    guard = header.upper().replace(".", "_").replace("-", "_")
+    params = f"{taps_per_phase} taps/phase, Kaiser beta {beta:g}, cutoff {cutoff:g} x output Nyquist"
+
+    with open(out_h, "w") as h:
+        h.write("// Decimator coefficients generated by tools/gen_decimator.py\n")
+        h.write("// Generated automatically - do not edit\n\n")
+        h.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        h.write("#include <stdint.h>\n\n")
+        h.write(f"#define DECIMATOR_TAPS_PER_PHASE  {taps_per_phase}\n\n")
+        for ratio, q in tables.items():
+            h.write(f"extern const int16_t decimator_fir{ratio}[{len(q)}];\n")
+        h.write(f"\n#endif // {guard}\n")
+
+    with open(out_c, "w") as c:
+        c.write("// Decimator coefficients generated by tools/gen_decimator.py\n")
+        c.write("// Generated automatically - do not edit\n")
+        c.write(f"// {params}\n\n")
+        c.write(f'#include "{header}"\n\n')
+        for ratio, q in tables.items():
+            c.write(f"// {ratio}x: linear phase, Q15, sum 32768\n")
+            c.write(f"const int16_t decimator_fir{ratio}[{len(q)}] = {{\n")
+            for i in range(0, len(q), 8):
+                line = "    " + ", ".join(f"{v:6d}" for v in q[i:i + 8])
+                if i + 8 < len(q):
+                    line += ","
+                c.write(line + "\n")
+            c.write("};\n\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Gera os coeficientes Q15 dos decimadores")
+    parser.add_argument("--taps-per-phase", type=int, default=12)
+    parser.add_argument("--beta", type=float, default=5.0, help="Kaiser window beta")
+    parser.add_argument("--cutoff", type=float, default=0.9, help="corte, em fração do Nyquist de saída")
+    parser.add_argument("--output", default="src/decimator_data.c")
+    args = parser.parse_args()
+
+    out_h = os.path.splitext(args.output)[0] + ".h"
+    print(f"🎚️  Gerando decimadores 2x/4x: {args.taps_per_phase} taps por fase")
+    generate([2, 4], args.taps_per_phase, args.beta, args.cutoff, args.output, out_h)
+    print(f"✅ {args.output} / {out_h}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+"""
+Filterbank Generator
+Gera as tabelas esparsas (início, comprimento, pesos Q15) que mapeiam os bins
+da FFT para as bandas do visualizer, nos layouts linear, mel, bark e log, tanto
+para a FFT única quanto para o analisador multi-resolução (uma FFT por oitava)
+"""
+
+import argparse
+import math
+import os
+
+LAYOUTS = ["linear", "mel", "bark", "log"]
+
+
+def hz_to_mel(f):
+    return 2595.0 * math.log10(1.0 + f / 700.0)
+
+
+def mel_to_hz(m):
+    return 700.0 * (10.0 ** (m / 2595.0) - 1.0)
+
+
+def hz_to_bark(f):
+    # Traunmüller
+    return 26.81 * f / (1960.0 + f) - 0.53
+
+
+def bark_to_hz(z):
+    return 1960.0 * (z + 0.53) / (26.28 - z)
+
+
+def band_edges(layout, num_bands, fmin, fmax):
+    """
+    Retorna num_bands + 2 frequências: bordas/centros dos filtros triangulares
+    """
+    n = num_bands + 2
+    if layout == "mel":
+        lo, hi = hz_to_mel(fmin), hz_to_mel(fmax)
+        return [mel_to_hz(lo + (hi - lo) * i / (n - 1)) for i in range(n)]
+    if layout == "bark":
+        lo, hi = hz_to_bark(fmin), hz_to_bark(fmax)
+        return [bark_to_hz(lo + (hi - lo) * i / (n - 1)) for i in range(n)]
+    if layout == "log":
+        return [fmin * (fmax / fmin) ** (i / (n - 1)) for i in range(n)]
+    raise ValueError(layout)
+
+
+def linear_bands(num_bins, num_bands):
+    # Mesma divisão do fft_to_frequency_bins original: grupos iguais, média simples
+    size = num_bins // num_bands
+    return [(i * size, [1.0] * size) for i in range(num_bands)]
+
+
+def triangular_bands(layout, num_bins, num_bands, sample_rate, fmin):
+    bin_hz = sample_rate / (2.0 * num_bins)
+    edges = band_edges(layout, num_bands, fmin, sample_rate / 2.0)
+    bands = []
+
+    for b in range(num_bands):
+        lo, center, hi = edges[b], edges[b + 1], edges[b + 2]
+        weights = {}
+        for k in range(num_bins):
+            f = k * bin_hz
+            if lo < f < hi:
+                w = (f - lo) / (center - lo) if f <= center else (hi - f) / (hi - center)
+                if w > 0.0:
+                    weights[k] = w
+
+        if not weights:
+            # Filtro mais estreito que um bin: usa o bin mais próximo do centro
+            weights[min(num_bins - 1, int(round(center / bin_hz)))] = 1.0
+
+        start = min(weights)
+        end = max(weights)
+        bands.append((start, [weights.get(k, 0.0) for k in range(start, end + 1)]))
+
+    return bands
+
+
+def band_shapes(layout, num_bands, sample_rate, fmin):
+    """
+    (lo, centro, hi, plano) de cada banda, em Hz
+    """
+    nyquist = sample_rate / 2.0
+    if layout == "linear":
+        w = nyquist / num_bands
+        return [(i * w, (i + 0.5) * w, (i + 1) * w, True) for i in range(num_bands)]
+    edges = band_edges(layout, num_bands, fmin, nyquist)
+    return [(edges[b], edges[b + 1], edges[b + 2], False) for b in range(num_bands)]
+
+
+def shape_weight(f, lo, center, hi, flat):
+    if flat:
+        return 1.0 if lo <= f < hi else 0.0
+    if not lo < f < hi:
+        return 0.0
+    return (f - lo) / (center - lo) if f <= center else (hi - f) / (hi - center)
+
+
+def multires_bands(layout, size, octaves, num_bands, sample_rate, fmin, min_bins):
+    """
+    Bandas sobre os espectros concatenados das oitavas (oitava k a sample_rate / 2^k,
+    FFT de `size` pontos). Cada banda usa a oitava mais alta (janela mais curta) em que
+    cobre pelo menos `min_bins` bins dentro da banda útil do decimador.
+    """
+    half = size // 2
+    bands = []
+    chosen = []
+
+    for lo, center, hi, flat in band_shapes(layout, num_bands, sample_rate, fmin):
+        def usable(k):
+            rate = sample_rate / 2 ** k
+            # Acima de 0.3 * rate a oitava decimada tem aliasing do half-band
+            return hi <= (0.5 if k == 0 else 0.3) * rate
+
+        octave = None
+        for k in range(octaves):
+            if usable(k) and hi - lo >= min_bins * (sample_rate / 2 ** k) / size:
+                octave = k
+                break
+        if octave is None:
+            octave = max(k for k in range(octaves) if usable(k))
+
+        bin_hz = sample_rate / 2 ** octave / size
+        weights = {}
+        for j in range(half):
+            w = shape_weight(j * bin_hz, lo, center, hi, flat)
+            if w > 0.0:
+                weights[j] = w
+        if not weights:
+            weights[min(half - 1, int(round(center / bin_hz)))] = 1.0
+
+        start = min(weights)
+        end = max(weights)
+        bands.append((octave * half + start, [weights.get(j, 0.0) for j in range(start, end + 1)]))
+        chosen.append(octave)
+
+    return bands, chosen
+
+
+def to_q15(weights):
+    """
+    Normaliza para soma 1 (média ponderada) e quantiza para Q15
+    """
+    total = sum(weights)
+    q = [int(round(w / total * 32767)) for w in weights]
+    # Corrige o arredondamento no maior peso para a soma fechar em 32767
+    q[q.index(max(q))] += 32767 - sum(q)
+    return q
+
+
+def generate(fft_size, num_bands, sample_rate, fmin, multires_size, octaves, out_c, out_h):
+    num_bins = fft_size // 2
+    tables = {}
+
+    for layout in LAYOUTS:
+        if layout == "linear":
+            bands = linear_bands(num_bins, num_bands)
+        else:
+            bands = triangular_bands(layout, num_bins, num_bands, sample_rate, fmin)
+        tables[layout] = [(start, to_q15(w)) for start, w in bands]
+
+    for layout in LAYOUTS:
+        bands, chosen = multires_bands(layout, multires_size, octaves, num_bands, sample_rate, fmin, 3)
+        tables["multires_" + layout] = [(start, to_q15(w)) for start, w in bands]
+        print(f"   - multires {layout}: oitavas {chosen}")
+
+    header = os.path.basename(out_h)
+    guard = header.upper().replace(".", "_").replace("-", "_")
+
+    with open(out_h, "w") as h:
+        h.write("// Filterbank tables generated by tools/gen_filterbank.py\n")
+        h.write("// Generated automatically - do not edit\n\n")
+        h.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        h.write('#include "filterbank.h"\n\n')
+        h.write(f"#define FILTERBANK_FFT_SIZE     {fft_size}\n")
+        h.write(f"#define FILTERBANK_NUM_BANDS    {num_bands}\n")
+        h.write(f"#define FILTERBANK_SAMPLE_RATE  {sample_rate}\n")
+        max_weights = max(sum(len(w) for _, w in bands) for name, bands in tables.items()
+                          if not name.startswith("multires_"))
+        h.write(f"#define FILTERBANK_MAX_WEIGHTS  {max_weights}\n\n")
+        max_weights = max(sum(len(w) for _, w in bands) for name, bands in tables.items()
+                          if name.startswith("multires_"))
+        h.write(f"// Multi-resolution tables index {octaves} concatenated spectra of {multires_size // 2} bins\n")
+        h.write(f"#define FILTERBANK_MULTIRES_SIZE        {multires_size}\n")
+        h.write(f"#define FILTERBANK_MULTIRES_OCTAVES     {octaves}\n")
+        h.write(f"#define FILTERBANK_MULTIRES_MAX_WEIGHTS {max_weights}\n\n")
+        for layout, bands in tables.items():
+            total = sum(len(w) for _, w in bands)
+            h.write(f"extern const filterbank_band_t filterbank_{layout}_bands[{num_bands}];\n")
+            h.write(f"extern const int16_t filterbank_{layout}_weights[{total}];\n")
+        h.write(f"\n#endif // {guard}\n")
+
+    with open(out_c, "w") as c:
+        c.write("// Filterbank tables generated by tools/gen_filterbank.py\n")
+        c.write("// Generated automatically - do not edit\n")
+        c.write(f"// FFT size {fft_size}, {num_bands} bands, {sample_rate} Hz, fmin {fmin:g} Hz\n")
+        c.write(f"// Multi-resolution: {octaves} octaves of {multires_size}-point FFTs\n\n")
+        c.write(f'#include "{header}"\n\n')
+        for layout, bands in tables.items():
+            offset = 0
+            c.write(f"const filterbank_band_t filterbank_{layout}_bands[{num_bands}] = {{\n")
+            for start, w in bands:
+                c.write(f"    {{ {start:4d}, {len(w):3d}, {offset:5d} }},\n")
+                offset += len(w)
+            c.write("};\n\n")
+
+            c.write(f"const int16_t filterbank_{layout}_weights[{offset}] = {{\n")
+            flat = [q for _, w in bands for q in w]
+            for i in range(0, len(flat), 12):
+                line = "    " + ", ".join(f"{q:5d}" for q in flat[i:i + 12])
+                if i + 12 < len(flat):
+                    line += ","
+                c.write(line + "\n")
+            c.write("};\n\n")
+
+    for name, bands in tables.items():
+        total = sum(len(w) for _, w in bands)
+        print(f"   - {name}: {total} pesos")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate sparse filterbank tables")
+    parser.add_argument("--fft-size", type=int, default=512)
+    parser.add_argument("--bands", type=int, default=64)
+    parser.add_argument("--sample-rate", type=int, default=22050)
+    parser.add_argument("--fmin", type=float, default=30.0, help="lowest band edge in Hz (mel/bark/log)")
+    parser.add_argument("--multires-size", type=int, default=128, help="FFT size per octave")
+    parser.add_argument("--octaves", type=int, default=6, help="octaves of the multi-resolution analyzer")
+    parser.add_argument("--output", default="src/filterbank_data.c")
+    args = parser.parse_args()
+
+    out_h = os.path.splitext(args.output)[0] + ".h"
+    print(f"🎛️  Gerando filterbank: FFT {args.fft_size}, {args.bands} bandas, {args.sample_rate} Hz")
+    generate(args.fft_size, args.bands, args.sample_rate, args.fmin,
+             args.multires_size, args.octaves, args.output, out_h)
+    print(f"✅ {args.output} / {out_h}")
+
+
+if __name__ == "__main__":
+    main()
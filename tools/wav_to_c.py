@@ -8,9 +8,10 @@ import wave
 import sys
 import os
 
-def wav_to_c_array(input_file, output_file, array_name="audio_data"):
+def wav_to_c_array(input_file, output_file, array_name="audio_data", stereo=False):
     """
-    Converte um arquivo WAV para um array C
+    Converte um arquivo WAV para um array C. Com stereo=True um arquivo estéreo
+    fica intercalado (L, R, L, R...) e AUDIO_LENGTH conta quadros, não amostras
     """
     try:
         # Abrir arquivo WAV
@@ -29,7 +30,11 @@ def wav_to_c_array(input_file, output_file, array_name="audio_data"):
             print(f"   - Duração: {num_frames / sample_rate:.2f} segundos")
             
             # Verificar se é compatível
-            if channels != 1:
+            if channels > 2:
+                print("⚠️  Apenas mono e estéreo suportados!")
+                return False
+            stereo = stereo and channels == 2
+            if channels != 1 and not stereo:
                 print("⚠️  Convertendo para mono...")
             
             if sample_width != 2:
@@ -48,6 +53,10 @@ def wav_to_c_array(input_file, output_file, array_name="audio_data"):
                 for i in range(0, len(audio_data), 2):
                     sample = struct.unpack('<h', audio_data[i:i+2])[0]
                     samples.append(sample)
+            elif stereo:
+                # Estéreo - manter os dois canais intercalados
+                for i in range(0, len(audio_data), 2):
+                    samples.append(struct.unpack('<h', audio_data[i:i+2])[0])
             else:
                 # Estéreo - converter para mono (média)
                 for i in range(0, len(audio_data), 4):
@@ -56,6 +65,9 @@ def wav_to_c_array(input_file, output_file, array_name="audio_data"):
                     mono = (left + right) // 2
                     samples.append(mono)
             
+            out_channels = 2 if stereo else 1
+            frames = len(samples) // out_channels
+            
             # Gerar arquivo C
             with open(output_file, 'w') as c_file:
                 c_file.write(f"// Audio data converted from {input_file}\n")
@@ -63,9 +75,9 @@ def wav_to_c_array(input_file, output_file, array_name="audio_data"):
                 c_file.write(f"#include <stdint.h>\n\n")
                 c_file.write(f"// Audio parameters\n")
                 c_file.write(f"#define AUDIO_SAMPLE_RATE {sample_rate}\n")
-                c_file.write(f"#define AUDIO_CHANNELS {1}\n")  # Sempre mono
-                c_file.write(f"#define AUDIO_LENGTH {len(samples)}\n")
-                c_file.write(f"#define AUDIO_DURATION_MS {int(len(samples) * 1000 / sample_rate)}\n\n")
+                c_file.write(f"#define AUDIO_CHANNELS {out_channels}\n")
+                c_file.write(f"#define AUDIO_LENGTH {frames}\n")
+                c_file.write(f"#define AUDIO_DURATION_MS {int(frames * 1000 / sample_rate)}\n\n")
                 
                 # Array de dados
                 c_file.write(f"const int16_t {array_name}[{len(samples)}] = {{\n")
@@ -88,10 +100,12 @@ def wav_to_c_array(input_file, output_file, array_name="audio_data"):
                     h_file.write(f"#define {guard_name}\n\n")
                     h_file.write(f"#include <stdint.h>\n\n")
                     h_file.write(f"// Audio parameters\n")
-                    h_file.write(f"#define AUDIO_SAMPLE_RATE {sample_rate}\n")
-                    h_file.write(f"#define AUDIO_CHANNELS {1}\n")
-                    h_file.write(f"#define AUDIO_LENGTH {len(samples)}\n")
-                    h_file.write(f"#define AUDIO_DURATION_MS {int(len(samples) * 1000 / sample_rate)}\n\n")
+                    # AUDIO_SAMPLE_RATE (config.h) é a taxa de análise; a do arquivo pode
+                    # ser 2x ou 4x maior, e o visualizer decima antes da FFT
+                    h_file.write(f"#define AUDIO_TRACK_SAMPLE_RATE {sample_rate}\n")
+                    h_file.write(f"#define AUDIO_CHANNELS {out_channels}\n")
+                    h_file.write(f"#define AUDIO_LENGTH {frames}\n")
+                    h_file.write(f"#define AUDIO_DURATION_MS {int(frames * 1000 / sample_rate)}\n\n")
                     h_file.write(f"extern const int16_t {array_name}[{len(samples)}];\n\n")
                     h_file.write(f"#endif // {guard_name}\n")
             
@@ -108,13 +122,17 @@ def wav_to_c_array(input_file, output_file, array_name="audio_data"):
         return False
 
 def main():
-    if len(sys.argv) < 2:
-        print("Uso: python3 wav_to_c.py <arquivo.wav> [nome_array]")
+    args = [a for a in sys.argv[1:] if a != "--stereo"]
+    stereo = "--stereo" in sys.argv[1:]
+    
+    if len(args) < 1:
+        print("Uso: python3 wav_to_c.py [--stereo] <arquivo.wav> [nome_array]")
         print("Exemplo: python3 wav_to_c.py intensidade-intro.wav intensidade_audio")
+        print("  --stereo  mantém L/R intercalados em vez de converter para mono")
         sys.exit(1)
     
-    input_file = sys.argv[1]
-    array_name = sys.argv[2] if len(sys.argv) > 2 else "audio_data"
+    input_file = args[0]
+    array_name = args[1] if len(args) > 1 else "audio_data"
     
     # Gerar nome do arquivo de saída
     base_name = os.path.splitext(os.path.basename(input_file))[0]
@@ -129,15 +147,17 @@ def main():
     # Criar diretório src se não existir
     os.makedirs("src", exist_ok=True)
     
-    success = wav_to_c_array(input_file, output_file, array_name)
+    success = wav_to_c_array(input_file, output_file, array_name, stereo)
     
     if success:
         print(f"\n📋 Próximos passos:")
-        print(f"1. Inclua o header no main.c:")
-        print(f"   #include \"{base_name}_data.h\"")
+        print(f"1. Selecione a faixa no build:")
+        print(f"   make TRACK={base_name}")
         print(f"2. Use os dados:")
         print(f"   track.samples = (int16_t*){array_name};")
         print(f"   track.length = AUDIO_LENGTH;")
+        print(f"   track.sample_rate = AUDIO_TRACK_SAMPLE_RATE;")
+        print(f"   track.channels = AUDIO_CHANNELS;")
     else:
         sys.exit(1)
 